@@ -0,0 +1,942 @@
+#ifndef BF16_H
+#define BF16_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* ============= BFloat16 Implementation ============= */
+
+typedef struct {
+    uint16_t bits;
+} bf16_t;
+
+#define BF16_EXP_BIAS 127
+#define BF16_SIGN_MASK 0x8000U
+#define BF16_EXP_MASK 0x7F80U
+#define BF16_MANT_MASK 0x007FU
+
+#define BF16_NAN() ((bf16_t) {.bits = 0x7FC0})
+#define BF16_ZERO() ((bf16_t) {.bits = 0x0000})
+
+static const bf16_t bf16_one = {.bits = 0x3F80};
+static const bf16_t bf16_two = {.bits = 0x4000};
+
+static inline bool bf16_isnan(bf16_t a)
+{
+    return ((a.bits & BF16_EXP_MASK) == BF16_EXP_MASK) &&
+           (a.bits & BF16_MANT_MASK);
+}
+
+static inline bool bf16_isinf(bf16_t a)
+{
+    return ((a.bits & BF16_EXP_MASK) == BF16_EXP_MASK) &&
+           !(a.bits & BF16_MANT_MASK);
+}
+
+static inline bool bf16_iszero(bf16_t a)
+{
+    return !(a.bits & 0x7FFF);
+}
+
+/* Normal exponents 1-254 map to 0..0x7E80 after the subtract, zero and
+ * subnormals wrap around and Inf/NaN land above. One compare per
+ * operand and a bitwise and, so the fast path costs a single branch. */
+static inline bool bf16_normal2(bf16_t a, bf16_t b)
+{
+    uint32_t ea = (uint32_t) (a.bits & 0x7F80) - 0x0080;
+    uint32_t eb = (uint32_t) (b.bits & 0x7F80) - 0x0080;
+    return (ea < 0x7F00) & (eb < 0x7F00);
+}
+
+/* Out-of-line home of the special-operand classification, kept away
+ * from the normal-operand fast paths */
+#define BF16_COLD __attribute__((noinline, cold))
+
+static inline unsigned clz(uint32_t x)
+{
+    int n = 32, c = 16;
+    do {
+        uint32_t y = x >> c;
+        if (y) {
+            n -= c;
+            x = y;
+        }
+        c >>= 1;
+    } while (c);
+    return n - x;
+}
+
+/* Rounding of add, mul, div and fma: 0 truncates (the default), 1
+ * rounds to nearest even, e.g. make BF16_ROUND_NEAREST=1 */
+#ifndef BF16_ROUND_NEAREST
+#define BF16_ROUND_NEAREST 0
+#endif
+
+/* sig >> shift with every bit shifted out folded into bit 0 */
+static inline uint32_t bf16_shr_sticky(uint32_t sig, uint32_t shift)
+{
+    if (shift > 31)
+        return sig != 0;
+    if (!shift)
+        return sig;
+    return (sig >> shift) | ((sig & ((1U << shift) - 1)) != 0);
+}
+
+/* Round and pack sig * 2^(exp - 127 - 15): the leading one of sig is at
+ * bit 15, bits 7-0 are guard bits with a sticky bit 0. Subnormal and
+ * overflowing results come out right in both rounding modes. */
+static inline bf16_t bf16_round_pack(uint32_t sign, int32_t exp, uint32_t sig)
+{
+    if (exp <= 0) {
+        sig = bf16_shr_sticky(sig, 1 - exp);
+        exp = 1;
+    }
+
+    uint32_t mant = sig >> 8;
+#if BF16_ROUND_NEAREST
+    uint32_t rest = sig & 0xFF;
+    mant += rest > 0x80 || (rest == 0x80 && (mant & 1));
+#endif
+
+    /* The hidden bit carries into the exponent, so a subnormal that
+     * rounds up becomes normal and 0x1FF rounds into the next binade */
+    uint32_t bits = ((uint32_t) (exp - 1) << 7) + mant;
+    if (bits >= 0x7F80)
+        return (bf16_t) {.bits = sign | 0x7F80};
+    return (bf16_t) {.bits = sign | bits};
+}
+
+/* a + b with 8 guard bits, for finite, nonzero a and b */
+static inline bf16_t bf16_add_round(bf16_t a, bf16_t b)
+{
+    /* Larger magnitude first */
+    if ((a.bits & 0x7FFF) < (b.bits & 0x7FFF)) {
+        bf16_t t = a;
+        a = b;
+        b = t;
+    }
+
+    int32_t exp_a = (a.bits >> 7) & 0xFF, exp_b = (b.bits >> 7) & 0xFF;
+    uint32_t sig_a = (a.bits & 0x7F) << 8, sig_b = (b.bits & 0x7F) << 8;
+    if (exp_a)
+        sig_a |= 0x8000;
+    else
+        exp_a = 1;
+    if (exp_b)
+        sig_b |= 0x8000;
+    else
+        exp_b = 1;
+
+    sig_b = bf16_shr_sticky(sig_b, exp_a - exp_b);
+
+    uint32_t sig;
+    if ((a.bits ^ b.bits) & 0x8000) {
+        sig = sig_a - sig_b;
+        if (!sig)
+            return BF16_ZERO();
+        int32_t lz = clz(sig) - 16;
+        sig <<= lz;
+        exp_a -= lz;
+    } else {
+        sig = sig_a + sig_b;
+        if (sig >> 16) {
+            sig = bf16_shr_sticky(sig, 1);
+            exp_a++;
+        }
+    }
+    return bf16_round_pack(a.bits & 0x8000, exp_a, sig);
+}
+
+/* Arithmetic of bf16_add for finite, nonzero a and b; the callers
+ * classify the operands */
+static inline bf16_t bf16_add_core(bf16_t a, bf16_t b)
+{
+#if BF16_ROUND_NEAREST
+    return bf16_add_round(a, b);
+#else
+    uint16_t sign_a = a.bits >> 15 & 0x1, sign_b = b.bits >> 15 & 1;
+    int16_t exp_a = a.bits >> 7 & 0xFF, exp_b = b.bits >> 7 & 0xFF;
+    uint16_t mant_a = a.bits & 0x7F, mant_b = b.bits & 0x7F;
+
+    /* if a, b is normal; a subnormal is scaled like exponent 1 */
+    if (exp_a)
+        mant_a |= 0x80;
+    else
+        exp_a = 1;
+    if (exp_b)
+        mant_b |= 0x80;
+    else
+        exp_b = 1;
+
+    int16_t exp_diff = exp_a - exp_b;
+    uint16_t result_sign;
+    int32_t result_exp;
+    uint32_t result_mant;
+
+    /* deal with result of exp */
+    /* An operand more than 8 binades down only decides whether the
+     * truncated result is the other one or one ulp below it */
+    if (exp_diff > 0) {
+        result_exp = exp_b;
+        if (exp_diff > 8)
+            return (bf16_t) {.bits = a.bits - (sign_a != sign_b)};
+        mant_a <<= exp_diff;
+    } else if (exp_diff < 0) {
+        result_exp = exp_a;
+        if (exp_diff < -8)
+            return (bf16_t) {.bits = b.bits - (sign_a != sign_b)};
+        mant_b <<= -exp_diff;
+    } else
+        result_exp = exp_a;
+
+    if (sign_a == sign_b) {
+        result_sign = sign_a;
+        result_mant = (uint32_t) mant_a + mant_b;
+    } else {
+        if (mant_a >= mant_b) {
+            result_sign = sign_a;
+            result_mant = mant_a - mant_b;
+        } else {
+            result_sign = sign_b;
+            result_mant = mant_b - mant_a;
+        }
+        if (!result_mant)
+            return BF16_ZERO();
+    }
+
+    /* Normalize in one shift: the leading one goes to bit 7, or as far
+     * as exponent 0 allows for a subnormal result */
+    int32_t shift = 24 - (int32_t) clz(result_mant);
+    result_exp += shift;
+    if (result_exp >= 0xFF)
+        return (bf16_t) {.bits = result_sign << 15 | 0x7F80};
+    if (result_exp <= 0) {
+        shift += 1 - result_exp;
+        result_exp = 0;
+    }
+    if (shift >= 0)
+        result_mant >>= shift;
+    else
+        result_mant <<= -shift;
+
+    return (bf16_t) {
+        .bits =
+            result_sign << 15 | (result_exp & 0xFF) << 7 | result_mant & 0x7F,
+    };
+#endif
+}
+
+/* bf16_add for zero, subnormal, infinite or NaN operands */
+static BF16_COLD bf16_t bf16_add_special(bf16_t a, bf16_t b)
+{
+    uint16_t sign_a = a.bits >> 15 & 0x1, sign_b = b.bits >> 15 & 1;
+    int16_t exp_a = a.bits >> 7 & 0xFF, exp_b = b.bits >> 7 & 0xFF;
+    uint16_t mant_a = a.bits & 0x7F, mant_b = b.bits & 0x7F;
+
+    /* Infinity and NaN */
+    if (exp_a == 0xFF) {
+        if (mant_a)
+            return a;
+        if (exp_b == 0xFF)
+            return (mant_b || sign_a == sign_b) ? b : BF16_NAN();
+        return a;
+    }
+
+    /* if a is normal/denormal, but b is infinity/NaN */
+    if (exp_b == 0xFF)
+        return b;
+
+    /* if a == 0, b == 0; +0 + -0 is +0 */
+    if (!exp_a && !mant_a)
+        return (!exp_b && !mant_b) ? (bf16_t) {.bits = a.bits & b.bits} : b;
+    if (!exp_b && !mant_b)
+        return a;
+
+    return bf16_add_core(a, b);
+}
+
+static inline bf16_t bf16_add(bf16_t a, bf16_t b)
+{
+    if (bf16_normal2(a, b))
+        return bf16_add_core(a, b);
+    return bf16_add_special(a, b);
+}
+
+static inline bf16_t bf16_sub(bf16_t a, bf16_t b)
+{
+    b.bits ^= 0x8000U;
+    return bf16_add(a, b);
+}
+
+/* Mantissa multiply engine for bf16_mul: 1 uses the quarter-square
+ * table below, 0 the __mulsi3 shift-add loop */
+#ifndef BF16_MUL_QSQ
+#define BF16_MUL_QSQ 1
+#endif
+
+/* floor(n * n / 4) for n = 0..511, folded at compile time */
+#define QSQ1(n) (((n) * (n)) >> 2)
+#define QSQ4(n) QSQ1(n), QSQ1(n + 1), QSQ1(n + 2), QSQ1(n + 3)
+#define QSQ16(n) QSQ4(n), QSQ4(n + 4), QSQ4(n + 8), QSQ4(n + 12)
+#define QSQ64(n) QSQ16(n), QSQ16(n + 16), QSQ16(n + 32), QSQ16(n + 48)
+#define QSQ256(n) QSQ64(n), QSQ64(n + 64), QSQ64(n + 128), QSQ64(n + 192)
+
+static const uint16_t bf16_qsq[512] = {QSQ256(0), QSQ256(256)};
+
+/* a * b = (a + b)^2 / 4 - (a - b)^2 / 4 for 8-bit a, b; the floors
+ * cancel because a + b and a - b have the same parity */
+static inline uint32_t bf16_mant_mul_qsq(uint32_t a, uint32_t b)
+{
+    uint32_t d = a > b ? a - b : b - a;
+    return (uint32_t) bf16_qsq[a + b] - bf16_qsq[d];
+}
+
+/* Arithmetic of bf16_mul for finite, nonzero a and b */
+static inline bf16_t bf16_mul_core(bf16_t a, bf16_t b, bool qsq)
+{
+    int16_t exp_a = ((a.bits >> 7) & 0xFF);
+    int16_t exp_b = ((b.bits >> 7) & 0xFF);
+    uint16_t mant_a = a.bits & 0x7F;
+    uint16_t mant_b = b.bits & 0x7F;
+
+    uint16_t result_sign = ((a.bits ^ b.bits) >> 15) & 1;
+
+    int16_t exp_adjust = 0;
+    if (!exp_a) {
+        while (!(mant_a & 0x80)) {
+            mant_a <<= 1;
+            exp_adjust--;
+        }
+        exp_a = 1;
+    } else
+        mant_a |= 0x80;
+    if (!exp_b) {
+        while (!(mant_b & 0x80)) {
+            mant_b <<= 1;
+            exp_adjust--;
+        }
+        exp_b = 1;
+    } else
+        mant_b |= 0x80;
+
+    uint32_t result_mant = qsq ? bf16_mant_mul_qsq(mant_a, mant_b)
+                               : (uint32_t) mant_a * mant_b;
+    int32_t result_exp = (int32_t) exp_a + exp_b - BF16_EXP_BIAS + exp_adjust;
+
+#if BF16_ROUND_NEAREST
+    /* The 16-bit product is exact, no sticky bit needed */
+    if (result_mant & 0x8000)
+        result_exp++;
+    else
+        result_mant <<= 1;
+    return bf16_round_pack(result_sign << 15, result_exp, result_mant);
+#else
+    /* Keep the hidden bit, a subnormal result shifts it down */
+    if (result_mant & 0x8000) {
+        result_mant = (result_mant >> 8) & 0xFF;
+        result_exp++;
+    } else
+        result_mant = (result_mant >> 7) & 0xFF;
+
+    if (result_exp >= 0xFF)
+        return (bf16_t) {.bits = (result_sign << 15) | 0x7F80};
+    if (result_exp <= 0) {
+        if (result_exp < -6)
+            return (bf16_t) {.bits = result_sign << 15};
+        result_mant >>= (1 - result_exp);
+        result_exp = 0;
+    }
+
+    return (bf16_t) {.bits = (result_sign << 15) | ((result_exp & 0xFF) << 7) |
+                             (result_mant & 0x7F)};
+#endif
+}
+
+static inline bf16_t bf16_mul_engine(bf16_t a, bf16_t b, bool qsq)
+{
+    uint16_t sign_a = (a.bits >> 15) & 1;
+    uint16_t sign_b = (b.bits >> 15) & 1;
+    int16_t exp_a = ((a.bits >> 7) & 0xFF);
+    int16_t exp_b = ((b.bits >> 7) & 0xFF);
+    uint16_t mant_a = a.bits & 0x7F;
+    uint16_t mant_b = b.bits & 0x7F;
+
+    uint16_t result_sign = sign_a ^ sign_b;
+
+    if (exp_a == 0xFF) {
+        if (mant_a)
+            return a;
+        if (exp_b == 0xFF && mant_b)
+            return b;
+        if (!exp_b && !mant_b)
+            return BF16_NAN();
+        return (bf16_t) {.bits = (result_sign << 15) | 0x7F80};
+    }
+    if (exp_b == 0xFF) {
+        if (mant_b)
+            return b;
+        if (!exp_a && !mant_a)
+            return BF16_NAN();
+        return (bf16_t) {.bits = (result_sign << 15) | 0x7F80};
+    }
+    if ((!exp_a && !mant_a) || (!exp_b && !mant_b))
+        return (bf16_t) {.bits = result_sign << 15};
+
+    return bf16_mul_core(a, b, qsq);
+}
+
+/* bf16_mul for zero, subnormal, infinite or NaN operands */
+static BF16_COLD bf16_t bf16_mul_special(bf16_t a, bf16_t b)
+{
+    return bf16_mul_engine(a, b, BF16_MUL_QSQ);
+}
+
+static inline bf16_t bf16_mul(bf16_t a, bf16_t b)
+{
+    if (bf16_normal2(a, b))
+        return bf16_mul_core(a, b, BF16_MUL_QSQ);
+    return bf16_mul_special(a, b);
+}
+
+/* Arithmetic of bf16_div for finite, nonzero a and b: a radix-4
+ * divider that retires two quotient bits per step by comparing the
+ * partial remainder with b, 2b and 3b */
+static inline bf16_t bf16_div_core(bf16_t a, bf16_t b)
+{
+    int32_t exp_a = (a.bits >> 7) & 0xFF, exp_b = (b.bits >> 7) & 0xFF;
+    uint32_t mant_a = a.bits & 0x7F, mant_b = b.bits & 0x7F;
+    uint32_t result_sign = (a.bits ^ b.bits) & 0x8000;
+
+    /* Subnormals get a hidden bit and a smaller exponent */
+    if (exp_a)
+        mant_a |= 0x80;
+    else {
+        int32_t lz = clz(mant_a) - 24;
+        mant_a <<= lz;
+        exp_a = 1 - lz;
+    }
+    if (exp_b)
+        mant_b |= 0x80;
+    else {
+        int32_t lz = clz(mant_b) - 24;
+        mant_b <<= lz;
+        exp_b = 1 - lz;
+    }
+
+    /* Put the quotient in [1, 2) so its leading bit is known */
+    int32_t result_exp = exp_a - exp_b + BF16_EXP_BIAS;
+    if (mant_a < mant_b) {
+        mant_a <<= 1;
+        result_exp--;
+    }
+
+    /* 1 + 8 quotient bits: hidden, 7 mantissa and one guard bit */
+    uint32_t b1 = mant_b, b2 = mant_b << 1, b3 = b1 + b2;
+    uint32_t rem = mant_a - mant_b, quotient = 1;
+    for (int i = 0; i < 4; i++) {
+        rem <<= 2;
+        uint32_t d1 = rem >= b1, d2 = rem >= b2, d3 = rem >= b3;
+        rem -= (-d1 & b1) + (-d2 & b1) + (-d3 & b1);
+        quotient = (quotient << 2) | (d1 + d2 + d3);
+    }
+
+#if BF16_ROUND_NEAREST
+    /* The guard bit lands on bit 7, the remainder is the sticky bit */
+    return bf16_round_pack(result_sign, result_exp,
+                           quotient << 7 | (rem != 0));
+#else
+    if (result_exp >= 0xFF)
+        return (bf16_t) {.bits = result_sign | 0x7F80};
+    if (result_exp <= 0) {
+        /* Subnormal result, truncated like the normal ones */
+        if (result_exp < -7)
+            return (bf16_t) {.bits = result_sign};
+        return (bf16_t) {.bits = result_sign | quotient >> (2 - result_exp)};
+    }
+    return (bf16_t) {.bits = result_sign | result_exp << 7 |
+                             ((quotient >> 1) & 0x7F)};
+#endif
+}
+
+/* bf16_div for zero, subnormal, infinite or NaN operands */
+static BF16_COLD bf16_t bf16_div_special(bf16_t a, bf16_t b)
+{
+    uint16_t sign_a = (a.bits >> 15) & 1;
+    uint16_t sign_b = (b.bits >> 15) & 1;
+    int16_t exp_a = ((a.bits >> 7) & 0xFF);
+    int16_t exp_b = ((b.bits >> 7) & 0xFF);
+    uint16_t mant_a = a.bits & 0x7F;
+    uint16_t mant_b = b.bits & 0x7F;
+
+    uint16_t result_sign = sign_a ^ sign_b;
+
+    if (exp_a == 0xFF && mant_a)
+        return a;
+    if (exp_b == 0xFF) {
+        if (mant_b)
+            return b;
+        /* Inf/Inf = NaN */
+        if (exp_a == 0xFF && !mant_a)
+            return BF16_NAN();
+        return (bf16_t) {.bits = result_sign << 15};
+    }
+    if (!exp_b && !mant_b) {
+        if (!exp_a && !mant_a)
+            return BF16_NAN();
+        return (bf16_t) {.bits = (result_sign << 15) | 0x7F80};
+    }
+    if (exp_a == 0xFF) {
+        if (mant_a)
+            return a;
+        return (bf16_t) {.bits = (result_sign << 15) | 0x7F80};
+    }
+    if (!exp_a && !mant_a)
+        return (bf16_t) {.bits = result_sign << 15};
+
+    return bf16_div_core(a, b);
+}
+
+static inline bf16_t bf16_div(bf16_t a, bf16_t b)
+{
+    if (bf16_normal2(a, b))
+        return bf16_div_core(a, b);
+    return bf16_div_special(a, b);
+}
+
+/* Significand of finite, nonzero a with the hidden bit at bit 7;
+ * subnormals are normalized by lowering *exp instead */
+static inline uint32_t bf16_unpack(bf16_t a, int32_t *exp)
+{
+    uint32_t mant = a.bits & 0x7F;
+
+    *exp = (a.bits >> 7) & 0xFF;
+    if (*exp)
+        return mant | 0x80;
+    int32_t lz = clz(mant) - 24;
+    *exp = 1 - lz;
+    return mant << lz;
+}
+
+/* a * b + c for finite, nonzero operands. The product is exact with
+ * 1.0 at bit 28 and c is aligned to it, so the sum is normalized once
+ * and rounded once. */
+static inline bf16_t bf16_fma_core(bf16_t a, bf16_t b, bf16_t c)
+{
+    int32_t exp_a, exp_b, exp_c;
+    uint32_t mant_a = bf16_unpack(a, &exp_a), mant_b = bf16_unpack(b, &exp_b);
+    uint32_t mant_c = bf16_unpack(c, &exp_c);
+    uint32_t sign_p = (a.bits ^ b.bits) & 0x8000, sign_c = c.bits & 0x8000;
+
+    uint32_t prod = BF16_MUL_QSQ ? bf16_mant_mul_qsq(mant_a, mant_b)
+                                 : mant_a * mant_b;
+    uint32_t sig_p = prod << 14, sig_c = mant_c << 21;
+    int32_t exp_p = exp_a + exp_b - BF16_EXP_BIAS, exp;
+
+    if (exp_p >= exp_c) {
+        sig_c = bf16_shr_sticky(sig_c, exp_p - exp_c);
+        exp = exp_p;
+    } else {
+        sig_p = bf16_shr_sticky(sig_p, exp_c - exp_p);
+        exp = exp_c;
+    }
+
+    uint32_t sig, sign;
+    if (sign_p == sign_c) {
+        sig = sig_p + sig_c;
+        sign = sign_p;
+    } else if (sig_p >= sig_c) {
+        sig = sig_p - sig_c;
+        sign = sign_p;
+    } else {
+        sig = sig_c - sig_p;
+        sign = sign_c;
+    }
+    if (!sig)
+        return BF16_ZERO();
+
+    /* Single normalization: move the leading one to bit 15 */
+    int32_t lead = 31 - clz(sig);
+    exp += lead - 28;
+    if (lead > 15)
+        sig = bf16_shr_sticky(sig, lead - 15);
+    else
+        sig <<= 15 - lead;
+    return bf16_round_pack(sign, exp, sig);
+}
+
+/* bf16_fma for zero, subnormal, infinite or NaN operands */
+static BF16_COLD bf16_t bf16_fma_special(bf16_t a, bf16_t b, bf16_t c)
+{
+    /* A NaN, infinite or zero factor makes the product exact */
+    if (bf16_isnan(a) || bf16_isnan(b) || bf16_isinf(a) || bf16_isinf(b) ||
+        bf16_iszero(a) || bf16_iszero(b))
+        return bf16_add(bf16_mul(a, b), c);
+
+    /* The product is finite here, so c alone decides the result */
+    if (bf16_iszero(c))
+        return bf16_mul(a, b);
+    if (bf16_isnan(c) || bf16_isinf(c))
+        return c;
+
+    return bf16_fma_core(a, b, c);
+}
+
+static inline bf16_t bf16_fma(bf16_t a, bf16_t b, bf16_t c)
+{
+    if (bf16_normal2(a, b) & bf16_normal2(c, c))
+        return bf16_fma_core(a, b, c);
+    return bf16_fma_special(a, b, c);
+}
+
+/* ============= BFloat16 Array Kernels ============= */
+
+/* The operand classification is done once per array, then the loops
+ * call the arithmetic cores on two elements per 32-bit load/store */
+
+typedef struct {
+    uint32_t bits;
+} f32_t;
+
+/* fp32 a + b, round to nearest even */
+static uint32_t f32_add(uint32_t a, uint32_t b)
+{
+    uint32_t exp_a = (a >> 23) & 0xFF, exp_b = (b >> 23) & 0xFF;
+
+    /* Infinity and NaN */
+    if (exp_a == 0xFF || exp_b == 0xFF) {
+        if (exp_a == 0xFF && (a & 0x7FFFFF))
+            return a | 0x400000;
+        if (exp_b == 0xFF && (b & 0x7FFFFF))
+            return b | 0x400000;
+        if (exp_a == 0xFF && exp_b == 0xFF && ((a ^ b) & 0x80000000))
+            return 0x7FC00000;
+        return exp_a == 0xFF ? a : b;
+    }
+
+    /* Make |a| >= |b| */
+    if ((a & 0x7FFFFFFF) < (b & 0x7FFFFFFF)) {
+        uint32_t t = a;
+        a = b;
+        b = t;
+        t = exp_a;
+        exp_a = exp_b;
+        exp_b = t;
+    }
+
+    /* Significands with three guard bits; subnormals use exponent 1 */
+    uint32_t mant_a = a & 0x7FFFFF, mant_b = b & 0x7FFFFF;
+    if (exp_a)
+        mant_a |= 0x800000;
+    else
+        exp_a = 1;
+    if (exp_b)
+        mant_b |= 0x800000;
+    else
+        exp_b = 1;
+    mant_a <<= 3;
+    mant_b <<= 3;
+
+    /* Align b, folding the bits shifted out into the sticky bit */
+    uint32_t shift = exp_a - exp_b;
+    if (shift > 26)
+        mant_b = mant_b != 0;
+    else if (shift)
+        mant_b = (mant_b >> shift) | ((mant_b & ((1U << shift) - 1)) != 0);
+
+    uint32_t sign = a & 0x80000000, mant;
+    int32_t exp = exp_a;
+    if ((a ^ b) & 0x80000000) {
+        mant = mant_a - mant_b;
+        if (!mant)
+            return 0;
+        /* Renormalize, stopping at the subnormal exponent */
+        int32_t lz = clz(mant) - 5;
+        if (lz >= exp)
+            lz = exp - 1;
+        mant <<= lz;
+        exp -= lz;
+    } else {
+        mant = mant_a + mant_b;
+        if (mant >> 27) {
+            mant = (mant >> 1) | (mant & 1);
+            exp++;
+        }
+    }
+
+    uint32_t guard = mant & 7;
+    mant >>= 3;
+    if (guard > 4 || (guard == 4 && (mant & 1))) {
+        if (++mant >> 24) {
+            mant >>= 1;
+            exp++;
+        }
+    }
+    if (exp >= 0xFF)
+        return sign | 0x7F800000;
+    if (!(mant & 0x800000))
+        exp = 0;
+    return sign | (uint32_t) exp << 23 | (mant & 0x7FFFFF);
+}
+
+/* Exact fp32 product of finite, nonzero a and b */
+static inline uint32_t bf16_mul_f32_core(bf16_t a, bf16_t b)
+{
+    int32_t exp_a = (a.bits >> 7) & 0xFF, exp_b = (b.bits >> 7) & 0xFF;
+    uint32_t mant_a = a.bits & 0x7F, mant_b = b.bits & 0x7F;
+    uint32_t sign = (uint32_t) ((a.bits ^ b.bits) & 0x8000) << 16;
+
+    if (exp_a)
+        mant_a |= 0x80;
+    else {
+        int32_t lz = clz(mant_a) - 24;
+        mant_a <<= lz;
+        exp_a = 1 - lz;
+    }
+    if (exp_b)
+        mant_b |= 0x80;
+    else {
+        int32_t lz = clz(mant_b) - 24;
+        mant_b <<= lz;
+        exp_b = 1 - lz;
+    }
+
+    /* 8x8 bits fit the 24-bit significand, so only range can be lost */
+    uint32_t mant = BF16_MUL_QSQ ? bf16_mant_mul_qsq(mant_a, mant_b)
+                                 : mant_a * mant_b;
+    int32_t exp = exp_a + exp_b - BF16_EXP_BIAS;
+    if (mant & 0x8000) {
+        mant <<= 8;
+        exp++;
+    } else
+        mant <<= 9;
+
+    if (exp >= 0xFF)
+        return sign | 0x7F800000;
+    if (exp <= 0) {
+        if (exp < -23)
+            return sign;
+        mant >>= 1 - exp;
+        exp = 0;
+    }
+    return sign | (uint32_t) exp << 23 | (mant & 0x7FFFFF);
+}
+
+static inline uint32_t bf16_mul_f32(bf16_t a, bf16_t b)
+{
+    uint32_t sign = (uint32_t) ((a.bits ^ b.bits) & 0x8000) << 16;
+
+    if (bf16_isnan(a))
+        return (uint32_t) a.bits << 16 | 0x400000;
+    if (bf16_isnan(b))
+        return (uint32_t) b.bits << 16 | 0x400000;
+    if (bf16_isinf(a) || bf16_isinf(b)) {
+        if (bf16_iszero(a) || bf16_iszero(b))
+            return 0x7FC00000;
+        return sign | 0x7F800000;
+    }
+    if (bf16_iszero(a) || bf16_iszero(b))
+        return sign;
+    return bf16_mul_f32_core(a, b);
+}
+
+/* Both halves of w are finite and nonzero when both bit 15s survive:
+ * +0x7FFF sets a lane's bit 15 unless the lane is zero, and +0x0080
+ * carries into it only for an all-ones exponent */
+static inline uint32_t bf16x2_finite_nonzero(uint32_t w)
+{
+    return ((w & 0x7FFF7FFF) + 0x7FFF7FFF) &
+           ~((w & 0x7F807F80) + 0x00800080) & 0x80008000;
+}
+
+/* True when the arithmetic cores can take every element of x */
+static bool bf16_array_finite_nonzero(const bf16_t *x, size_t n)
+{
+    uint32_t ok = 0x80008000;
+    size_t i = 0;
+
+    if ((uintptr_t) x & 2) {
+        if (!n)
+            return true;
+        ok &= bf16x2_finite_nonzero(0x3F800000 | x[0].bits);
+        i = 1;
+    }
+    for (const uint32_t *w = (const uint32_t *) (x + i); i + 2 <= n; i += 2)
+        ok &= bf16x2_finite_nonzero(*w++);
+    if (i < n)
+        ok &= bf16x2_finite_nonzero(0x3F800000 | x[i].bits);
+    return ok == 0x80008000;
+}
+
+/* z = x + y */
+static void bf16_vadd(bf16_t *z, const bf16_t *x, const bf16_t *y, size_t n)
+{
+    size_t i = 0;
+
+    if (!bf16_array_finite_nonzero(x, n) || !bf16_array_finite_nonzero(y, n)) {
+        for (; i < n; i++)
+            z[i] = bf16_add(x[i], y[i]);
+        return;
+    }
+
+    if (!(((uintptr_t) z | (uintptr_t) x | (uintptr_t) y) & 3)) {
+        const uint32_t *xw = (const uint32_t *) x, *yw = (const uint32_t *) y;
+        uint32_t *zw = (uint32_t *) z;
+        for (; i + 2 <= n; i += 2) {
+            uint32_t a = *xw++, b = *yw++;
+            uint32_t lo = bf16_add_core((bf16_t) {a}, (bf16_t) {b}).bits;
+            uint32_t hi =
+                bf16_add_core((bf16_t) {a >> 16}, (bf16_t) {b >> 16}).bits;
+            *zw++ = lo | hi << 16;
+        }
+    }
+    for (; i < n; i++)
+        z[i] = bf16_add_core(x[i], y[i]);
+}
+
+/* z = x * y */
+static void bf16_vmul(bf16_t *z, const bf16_t *x, const bf16_t *y, size_t n)
+{
+    size_t i = 0;
+
+    if (!bf16_array_finite_nonzero(x, n) || !bf16_array_finite_nonzero(y, n)) {
+        for (; i < n; i++)
+            z[i] = bf16_mul(x[i], y[i]);
+        return;
+    }
+
+    if (!(((uintptr_t) z | (uintptr_t) x | (uintptr_t) y) & 3)) {
+        const uint32_t *xw = (const uint32_t *) x, *yw = (const uint32_t *) y;
+        uint32_t *zw = (uint32_t *) z;
+        for (; i + 2 <= n; i += 2) {
+            uint32_t a = *xw++, b = *yw++;
+            uint32_t lo =
+                bf16_mul_core((bf16_t) {a}, (bf16_t) {b}, BF16_MUL_QSQ).bits;
+            uint32_t hi = bf16_mul_core((bf16_t) {a >> 16}, (bf16_t) {b >> 16},
+                                        BF16_MUL_QSQ)
+                              .bits;
+            *zw++ = lo | hi << 16;
+        }
+    }
+    for (; i < n; i++)
+        z[i] = bf16_mul_core(x[i], y[i], BF16_MUL_QSQ);
+}
+
+/* y = a * x + y, fused so each element is rounded once */
+static void bf16_axpy(bf16_t *y, bf16_t a, const bf16_t *x, size_t n)
+{
+    size_t i = 0;
+
+    if (!bf16_array_finite_nonzero(&a, 1) ||
+        !bf16_array_finite_nonzero(x, n) || !bf16_array_finite_nonzero(y, n)) {
+        for (; i < n; i++)
+            y[i] = bf16_fma(a, x[i], y[i]);
+        return;
+    }
+
+    if (!(((uintptr_t) y | (uintptr_t) x) & 3)) {
+        const uint32_t *xw = (const uint32_t *) x;
+        uint32_t *yw = (uint32_t *) y;
+        for (; i + 2 <= n; i += 2, yw++) {
+            uint32_t u = *xw++, v = *yw;
+            uint32_t lo = bf16_fma_core(a, (bf16_t) {u}, (bf16_t) {v}).bits;
+            uint32_t hi =
+                bf16_fma_core(a, (bf16_t) {u >> 16}, (bf16_t) {v >> 16}).bits;
+            *yw = lo | hi << 16;
+        }
+    }
+    for (; i < n; i++)
+        y[i] = bf16_fma_core(a, x[i], y[i]);
+}
+
+/* sum of x * y, products exact and accumulated in fp32 */
+static f32_t bf16_dot(const bf16_t *x, const bf16_t *y, size_t n)
+{
+    uint32_t acc = 0;
+    size_t i = 0;
+
+    if (!bf16_array_finite_nonzero(x, n) || !bf16_array_finite_nonzero(y, n)) {
+        for (; i < n; i++)
+            acc = f32_add(acc, bf16_mul_f32(x[i], y[i]));
+        return (f32_t) {acc};
+    }
+
+    if (!(((uintptr_t) x | (uintptr_t) y) & 3)) {
+        const uint32_t *xw = (const uint32_t *) x, *yw = (const uint32_t *) y;
+        for (; i + 2 <= n; i += 2) {
+            uint32_t a = *xw++, b = *yw++;
+            acc = f32_add(acc, bf16_mul_f32_core((bf16_t) {a}, (bf16_t) {b}));
+            acc = f32_add(acc, bf16_mul_f32_core((bf16_t) {a >> 16},
+                                                 (bf16_t) {b >> 16}));
+        }
+    }
+    for (; i < n; i++)
+        acc = f32_add(acc, bf16_mul_f32_core(x[i], y[i]));
+    return (f32_t) {acc};
+}
+
+/* fp32 <-> bf16. A bf16 is the top half of an fp32, so both directions
+ * are shifts plus rounding; a NaN keeps its sign and top payload bits
+ * and comes out quiet. */
+
+/* Round to nearest even: the carry out of the low half moves into the
+ * exponent, so the largest values round up to Inf */
+static inline uint32_t bf16_bits_from_f32(uint32_t f)
+{
+    if ((f & 0x7FFFFFFF) > 0x7F800000)
+        return (f >> 16) | 0x0040;
+    return (f + 0x7FFF + ((f >> 16) & 1)) >> 16;
+}
+
+static inline bf16_t bf16_from_f32(f32_t f)
+{
+    return (bf16_t) {.bits = bf16_bits_from_f32(f.bits)};
+}
+
+static inline f32_t f32_from_bf16(bf16_t a)
+{
+    uint32_t f = (uint32_t) a.bits << 16;
+
+    if ((f & 0x7FFFFFFF) > 0x7F800000)
+        f |= 0x00400000;
+    return (f32_t) {f};
+}
+
+/* dst[i] = src[i] rounded to bf16, two results per 32-bit store */
+static void bf16_from_f32_array(bf16_t *dst, const f32_t *src, size_t n)
+{
+    size_t i = 0;
+
+    if (!((uintptr_t) dst & 3)) {
+        uint32_t *dw = (uint32_t *) dst;
+        for (; i + 2 <= n; i += 2) {
+            *dw++ = bf16_bits_from_f32(src[i].bits) |
+                    bf16_bits_from_f32(src[i + 1].bits) << 16;
+        }
+    }
+    for (; i < n; i++)
+        dst[i] = bf16_from_f32(src[i]);
+}
+
+/* dst[i] = src[i] widened to fp32, two elements per 32-bit load */
+static void f32_from_bf16_array(f32_t *dst, const bf16_t *src, size_t n)
+{
+    size_t i = 0;
+
+    if (!((uintptr_t) src & 3)) {
+        const uint32_t *sw = (const uint32_t *) src;
+        for (; i + 2 <= n; i += 2) {
+            uint32_t w = *sw++;
+            /* Bit 15 of a half is set when the half is a NaN; moved down
+             * to bit 6 it is that half's quiet bit */
+            uint32_t nan = ((w & 0x7FFF7FFF) + 0x007F007F) & 0x80008000;
+            w |= nan >> 9;
+            dst[i].bits = w << 16;
+            dst[i + 1].bits = w & 0xFFFF0000;
+        }
+    }
+    for (; i < n; i++)
+        dst[i] = f32_from_bf16(src[i]);
+}
+
+#endif /* BF16_H */
@@ -0,0 +1,524 @@
+/* Generated by make vectors (bf16_host_test --vectors); do not edit.
+ * Sampled operand pairs {a, b} followed by the reference add, sub, mul
+ * and div results, first truncated, then rounded to nearest even. */
+#ifndef BF16_VECTORS_H
+#define BF16_VECTORS_H
+
+#define BF16_VECTORS 512
+
+static const uint16_t bf16_vectors[BF16_VECTORS][10] = {
+    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x7fc0, 0x0000, 0x0000, 0x0000, 0x7fc0},
+    {0x0000, 0x8000, 0x0000, 0x0000, 0x8000, 0x7fc0, 0x0000, 0x0000, 0x8000, 0x7fc0},
+    {0x0000, 0x0001, 0x0001, 0x8001, 0x0000, 0x0000, 0x0001, 0x8001, 0x0000, 0x0000},
+    {0x0000, 0x807f, 0x807f, 0x007f, 0x8000, 0x8000, 0x807f, 0x007f, 0x8000, 0x8000},
+    {0x0000, 0x0080, 0x0080, 0x8080, 0x0000, 0x0000, 0x0080, 0x8080, 0x0000, 0x0000},
+    {0x0000, 0x7f7f, 0x7f7f, 0xff7f, 0x0000, 0x0000, 0x7f7f, 0xff7f, 0x0000, 0x0000},
+    {0x0000, 0xff7f, 0xff7f, 0x7f7f, 0x8000, 0x8000, 0xff7f, 0x7f7f, 0x8000, 0x8000},
+    {0x0000, 0x7f80, 0x7f80, 0xff80, 0x7fc0, 0x0000, 0x7f80, 0xff80, 0x7fc0, 0x0000},
+    {0x0000, 0xff80, 0xff80, 0x7f80, 0x7fc0, 0x8000, 0xff80, 0x7f80, 0x7fc0, 0x8000},
+    {0x0000, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x0000, 0x7f81, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x0000, 0x3f80, 0x3f80, 0xbf80, 0x0000, 0x0000, 0x3f80, 0xbf80, 0x0000, 0x0000},
+    {0x8000, 0x0000, 0x0000, 0x8000, 0x8000, 0x7fc0, 0x0000, 0x8000, 0x8000, 0x7fc0},
+    {0x8000, 0x8000, 0x8000, 0x0000, 0x0000, 0x7fc0, 0x8000, 0x0000, 0x0000, 0x7fc0},
+    {0x8000, 0x0001, 0x0001, 0x8001, 0x8000, 0x8000, 0x0001, 0x8001, 0x8000, 0x8000},
+    {0x8000, 0x807f, 0x807f, 0x007f, 0x0000, 0x0000, 0x807f, 0x007f, 0x0000, 0x0000},
+    {0x8000, 0x0080, 0x0080, 0x8080, 0x8000, 0x8000, 0x0080, 0x8080, 0x8000, 0x8000},
+    {0x8000, 0x7f7f, 0x7f7f, 0xff7f, 0x8000, 0x8000, 0x7f7f, 0xff7f, 0x8000, 0x8000},
+    {0x8000, 0xff7f, 0xff7f, 0x7f7f, 0x0000, 0x0000, 0xff7f, 0x7f7f, 0x0000, 0x0000},
+    {0x8000, 0x7f80, 0x7f80, 0xff80, 0x7fc0, 0x8000, 0x7f80, 0xff80, 0x7fc0, 0x8000},
+    {0x8000, 0xff80, 0xff80, 0x7f80, 0x7fc0, 0x0000, 0xff80, 0x7f80, 0x7fc0, 0x0000},
+    {0x8000, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x8000, 0x7f81, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x8000, 0x3f80, 0x3f80, 0xbf80, 0x8000, 0x8000, 0x3f80, 0xbf80, 0x8000, 0x8000},
+    {0x0001, 0x0000, 0x0001, 0x0001, 0x0000, 0x7f80, 0x0001, 0x0001, 0x0000, 0x7f80},
+    {0x0001, 0x8000, 0x0001, 0x0001, 0x8000, 0xff80, 0x0001, 0x0001, 0x8000, 0xff80},
+    {0x0001, 0x0001, 0x0002, 0x0000, 0x0000, 0x3f80, 0x0002, 0x0000, 0x0000, 0x3f80},
+    {0x0001, 0x807f, 0x807e, 0x0080, 0x8000, 0xbc01, 0x807e, 0x0080, 0x8000, 0xbc01},
+    {0x0001, 0x0080, 0x0081, 0x807f, 0x0000, 0x3c00, 0x0081, 0x807f, 0x0000, 0x3c00},
+    {0x0001, 0x7f7f, 0x7f7f, 0xff7e, 0x3cff, 0x0000, 0x7f7f, 0xff7f, 0x3cff, 0x0000},
+    {0x0001, 0xff7f, 0xff7e, 0x7f7f, 0xbcff, 0x8000, 0xff7f, 0x7f7f, 0xbcff, 0x8000},
+    {0x0001, 0x7f80, 0x7f80, 0xff80, 0x7f80, 0x0000, 0x7f80, 0xff80, 0x7f80, 0x0000},
+    {0x0001, 0xff80, 0xff80, 0x7f80, 0xff80, 0x8000, 0xff80, 0x7f80, 0xff80, 0x8000},
+    {0x0001, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x0001, 0x7f81, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x0001, 0x3f80, 0x3f80, 0xbf7f, 0x0001, 0x0001, 0x3f80, 0xbf80, 0x0001, 0x0001},
+    {0x807f, 0x0000, 0x807f, 0x807f, 0x8000, 0xff80, 0x807f, 0x807f, 0x8000, 0xff80},
+    {0x807f, 0x8000, 0x807f, 0x807f, 0x0000, 0x7f80, 0x807f, 0x807f, 0x0000, 0x7f80},
+    {0x807f, 0x0001, 0x807e, 0x8080, 0x8000, 0xc2fe, 0x807e, 0x8080, 0x8000, 0xc2fe},
+    {0x807f, 0x807f, 0x80fe, 0x0000, 0x0000, 0x3f80, 0x80fe, 0x0000, 0x0000, 0x3f80},
+    {0x807f, 0x0080, 0x0001, 0x80ff, 0x8000, 0xbf7e, 0x0001, 0x80ff, 0x8000, 0xbf7e},
+    {0x807f, 0x7f7f, 0x7f7e, 0xff7f, 0xc07d, 0x8000, 0x7f7f, 0xff7f, 0xc07d, 0x8000},
+    {0x807f, 0xff7f, 0xff7f, 0x7f7e, 0x407d, 0x0000, 0xff7f, 0x7f7f, 0x407d, 0x0000},
+    {0x807f, 0x7f80, 0x7f80, 0xff80, 0xff80, 0x8000, 0x7f80, 0xff80, 0xff80, 0x8000},
+    {0x807f, 0xff80, 0xff80, 0x7f80, 0x7f80, 0x0000, 0xff80, 0x7f80, 0x7f80, 0x0000},
+    {0x807f, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x807f, 0x7f81, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x807f, 0x3f80, 0x3f7f, 0xbf80, 0x807f, 0x807f, 0x3f80, 0xbf80, 0x807f, 0x807f},
+    {0x0080, 0x0000, 0x0080, 0x0080, 0x0000, 0x7f80, 0x0080, 0x0080, 0x0000, 0x7f80},
+    {0x0080, 0x8000, 0x0080, 0x0080, 0x8000, 0xff80, 0x0080, 0x0080, 0x8000, 0xff80},
+    {0x0080, 0x0001, 0x0081, 0x007f, 0x0000, 0x4300, 0x0081, 0x007f, 0x0000, 0x4300},
+    {0x0080, 0x807f, 0x0001, 0x00ff, 0x8000, 0xbf81, 0x0001, 0x00ff, 0x8000, 0xbf81},
+    {0x0080, 0x0080, 0x0100, 0x0000, 0x0000, 0x3f80, 0x0100, 0x0000, 0x0000, 0x3f80},
+    {0x0080, 0x7f7f, 0x7f7f, 0xff7e, 0x407f, 0x0000, 0x7f7f, 0xff7f, 0x407f, 0x0000},
+    {0x0080, 0xff7f, 0xff7e, 0x7f7f, 0xc07f, 0x8000, 0xff7f, 0x7f7f, 0xc07f, 0x8000},
+    {0x0080, 0x7f80, 0x7f80, 0xff80, 0x7f80, 0x0000, 0x7f80, 0xff80, 0x7f80, 0x0000},
+    {0x0080, 0xff80, 0xff80, 0x7f80, 0xff80, 0x8000, 0xff80, 0x7f80, 0xff80, 0x8000},
+    {0x0080, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x0080, 0x7f81, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x0080, 0x3f80, 0x3f80, 0xbf7f, 0x0080, 0x0080, 0x3f80, 0xbf80, 0x0080, 0x0080},
+    {0x7f7f, 0x0000, 0x7f7f, 0x7f7f, 0x0000, 0x7f80, 0x7f7f, 0x7f7f, 0x0000, 0x7f80},
+    {0x7f7f, 0x8000, 0x7f7f, 0x7f7f, 0x8000, 0xff80, 0x7f7f, 0x7f7f, 0x8000, 0xff80},
+    {0x7f7f, 0x0001, 0x7f7f, 0x7f7e, 0x3cff, 0x7f80, 0x7f7f, 0x7f7f, 0x3cff, 0x7f80},
+    {0x7f7f, 0x807f, 0x7f7e, 0x7f7f, 0xc07d, 0xff80, 0x7f7f, 0x7f7f, 0xc07d, 0xff80},
+    {0x7f7f, 0x0080, 0x7f7f, 0x7f7e, 0x407f, 0x7f80, 0x7f7f, 0x7f7f, 0x407f, 0x7f80},
+    {0x7f7f, 0x7f7f, 0x7f80, 0x0000, 0x7f80, 0x3f80, 0x7f80, 0x0000, 0x7f80, 0x3f80},
+    {0x7f7f, 0xff7f, 0x0000, 0x7f80, 0xff80, 0xbf80, 0x0000, 0x7f80, 0xff80, 0xbf80},
+    {0x7f7f, 0x7f80, 0x7f80, 0xff80, 0x7f80, 0x0000, 0x7f80, 0xff80, 0x7f80, 0x0000},
+    {0x7f7f, 0xff80, 0xff80, 0x7f80, 0xff80, 0x8000, 0xff80, 0x7f80, 0xff80, 0x8000},
+    {0x7f7f, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x7f7f, 0x7f81, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x7f7f, 0x3f80, 0x7f7f, 0x7f7e, 0x7f7f, 0x7f7f, 0x7f7f, 0x7f7f, 0x7f7f, 0x7f7f},
+    {0xff7f, 0x0000, 0xff7f, 0xff7f, 0x8000, 0xff80, 0xff7f, 0xff7f, 0x8000, 0xff80},
+    {0xff7f, 0x8000, 0xff7f, 0xff7f, 0x0000, 0x7f80, 0xff7f, 0xff7f, 0x0000, 0x7f80},
+    {0xff7f, 0x0001, 0xff7e, 0xff7f, 0xbcff, 0xff80, 0xff7f, 0xff7f, 0xbcff, 0xff80},
+    {0xff7f, 0x807f, 0xff7f, 0xff7e, 0x407d, 0x7f80, 0xff7f, 0xff7f, 0x407d, 0x7f80},
+    {0xff7f, 0x0080, 0xff7e, 0xff7f, 0xc07f, 0xff80, 0xff7f, 0xff7f, 0xc07f, 0xff80},
+    {0xff7f, 0x7f7f, 0x0000, 0xff80, 0xff80, 0xbf80, 0x0000, 0xff80, 0xff80, 0xbf80},
+    {0xff7f, 0xff7f, 0xff80, 0x0000, 0x7f80, 0x3f80, 0xff80, 0x0000, 0x7f80, 0x3f80},
+    {0xff7f, 0x7f80, 0x7f80, 0xff80, 0xff80, 0x8000, 0x7f80, 0xff80, 0xff80, 0x8000},
+    {0xff7f, 0xff80, 0xff80, 0x7f80, 0x7f80, 0x0000, 0xff80, 0x7f80, 0x7f80, 0x0000},
+    {0xff7f, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0xff7f, 0x7f81, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0xff7f, 0x3f80, 0xff7e, 0xff7f, 0xff7f, 0xff7f, 0xff7f, 0xff7f, 0xff7f, 0xff7f},
+    {0x7f80, 0x0000, 0x7f80, 0x7f80, 0x7fc0, 0x7f80, 0x7f80, 0x7f80, 0x7fc0, 0x7f80},
+    {0x7f80, 0x8000, 0x7f80, 0x7f80, 0x7fc0, 0xff80, 0x7f80, 0x7f80, 0x7fc0, 0xff80},
+    {0x7f80, 0x0001, 0x7f80, 0x7f80, 0x7f80, 0x7f80, 0x7f80, 0x7f80, 0x7f80, 0x7f80},
+    {0x7f80, 0x807f, 0x7f80, 0x7f80, 0xff80, 0xff80, 0x7f80, 0x7f80, 0xff80, 0xff80},
+    {0x7f80, 0x0080, 0x7f80, 0x7f80, 0x7f80, 0x7f80, 0x7f80, 0x7f80, 0x7f80, 0x7f80},
+    {0x7f80, 0x7f7f, 0x7f80, 0x7f80, 0x7f80, 0x7f80, 0x7f80, 0x7f80, 0x7f80, 0x7f80},
+    {0x7f80, 0xff7f, 0x7f80, 0x7f80, 0xff80, 0xff80, 0x7f80, 0x7f80, 0xff80, 0xff80},
+    {0x7f80, 0x7f80, 0x7f80, 0x7fc0, 0x7f80, 0x7fc0, 0x7f80, 0x7fc0, 0x7f80, 0x7fc0},
+    {0x7f80, 0xff80, 0x7fc0, 0x7f80, 0xff80, 0x7fc0, 0x7fc0, 0x7f80, 0xff80, 0x7fc0},
+    {0x7f80, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x7f80, 0x7f81, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x7f80, 0x3f80, 0x7f80, 0x7f80, 0x7f80, 0x7f80, 0x7f80, 0x7f80, 0x7f80, 0x7f80},
+    {0xff80, 0x0000, 0xff80, 0xff80, 0x7fc0, 0xff80, 0xff80, 0xff80, 0x7fc0, 0xff80},
+    {0xff80, 0x8000, 0xff80, 0xff80, 0x7fc0, 0x7f80, 0xff80, 0xff80, 0x7fc0, 0x7f80},
+    {0xff80, 0x0001, 0xff80, 0xff80, 0xff80, 0xff80, 0xff80, 0xff80, 0xff80, 0xff80},
+    {0xff80, 0x807f, 0xff80, 0xff80, 0x7f80, 0x7f80, 0xff80, 0xff80, 0x7f80, 0x7f80},
+    {0xff80, 0x0080, 0xff80, 0xff80, 0xff80, 0xff80, 0xff80, 0xff80, 0xff80, 0xff80},
+    {0xff80, 0x7f7f, 0xff80, 0xff80, 0xff80, 0xff80, 0xff80, 0xff80, 0xff80, 0xff80},
+    {0xff80, 0xff7f, 0xff80, 0xff80, 0x7f80, 0x7f80, 0xff80, 0xff80, 0x7f80, 0x7f80},
+    {0xff80, 0x7f80, 0x7fc0, 0xff80, 0xff80, 0x7fc0, 0x7fc0, 0xff80, 0xff80, 0x7fc0},
+    {0xff80, 0xff80, 0xff80, 0x7fc0, 0x7f80, 0x7fc0, 0xff80, 0x7fc0, 0x7f80, 0x7fc0},
+    {0xff80, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0xff80, 0x7f81, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0xff80, 0x3f80, 0xff80, 0xff80, 0xff80, 0xff80, 0xff80, 0xff80, 0xff80, 0xff80},
+    {0x7fc0, 0x0000, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x7fc0, 0x8000, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x7fc0, 0x0001, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x7fc0, 0x807f, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x7fc0, 0x0080, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x7fc0, 0x7f7f, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x7fc0, 0xff7f, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x7fc0, 0x7f80, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x7fc0, 0xff80, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x7fc0, 0x7f81, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x7fc0, 0x3f80, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x7f81, 0x0000, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x7f81, 0x8000, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x7f81, 0x0001, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x7f81, 0x807f, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x7f81, 0x0080, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x7f81, 0x7f7f, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x7f81, 0xff7f, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x7f81, 0x7f80, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x7f81, 0xff80, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x7f81, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x7f81, 0x7f81, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x7f81, 0x3f80, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x3f80, 0x0000, 0x3f80, 0x3f80, 0x0000, 0x7f80, 0x3f80, 0x3f80, 0x0000, 0x7f80},
+    {0x3f80, 0x8000, 0x3f80, 0x3f80, 0x8000, 0xff80, 0x3f80, 0x3f80, 0x8000, 0xff80},
+    {0x3f80, 0x0001, 0x3f80, 0x3f7f, 0x0001, 0x7f80, 0x3f80, 0x3f80, 0x0001, 0x7f80},
+    {0x3f80, 0x807f, 0x3f7f, 0x3f80, 0x807f, 0xfe81, 0x3f80, 0x3f80, 0x807f, 0xfe81},
+    {0x3f80, 0x0080, 0x3f80, 0x3f7f, 0x0080, 0x7e80, 0x3f80, 0x3f80, 0x0080, 0x7e80},
+    {0x3f80, 0x7f7f, 0x7f7f, 0xff7e, 0x7f7f, 0x0020, 0x7f7f, 0xff7f, 0x7f7f, 0x0020},
+    {0x3f80, 0xff7f, 0xff7e, 0x7f7f, 0xff7f, 0x8020, 0xff7f, 0x7f7f, 0xff7f, 0x8020},
+    {0x3f80, 0x7f80, 0x7f80, 0xff80, 0x7f80, 0x0000, 0x7f80, 0xff80, 0x7f80, 0x0000},
+    {0x3f80, 0xff80, 0xff80, 0x7f80, 0xff80, 0x8000, 0xff80, 0x7f80, 0xff80, 0x8000},
+    {0x3f80, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x3f80, 0x7f81, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0, 0x7fc0},
+    {0x3f80, 0x3f80, 0x4000, 0x0000, 0x3f80, 0x3f80, 0x4000, 0x0000, 0x3f80, 0x3f80},
+    {0x4619, 0x510c, 0x510c, 0xd10b, 0x57a7, 0x348b, 0x510c, 0xd10c, 0x57a7, 0x348c},
+    {0x553e, 0xd62e, 0xd5fd, 0x565d, 0xec01, 0xbe8b, 0xd5fd, 0x565e, 0xec01, 0xbe8c},
+    {0xa8b5, 0x0183, 0xa8b4, 0xa8b5, 0x8000, 0xe6b0, 0xa8b5, 0xa8b5, 0x8000, 0xe6b1},
+    {0x6d1f, 0xecb3, 0x6c8b, 0x6d78, 0xff80, 0xbfe3, 0x6c8b, 0x6d78, 0xff80, 0xbfe3},
+    {0x29d0, 0xba25, 0xba24, 0x3a25, 0xa486, 0xaf21, 0xba25, 0x3a25, 0xa486, 0xaf21},
+    {0xedbf, 0xee7b, 0xeead, 0x6e1b, 0x7f80, 0x3ec2, 0xeead, 0x6e1c, 0x7f80, 0x3ec3},
+    {0x53b8, 0xb55a, 0x53b7, 0x53b8, 0xc99c, 0xddd8, 0x53b8, 0x53b8, 0xc99d, 0xddd8},
+    {0xa9ee, 0x2788, 0xa9e5, 0xa9f6, 0x91fc, 0xc1e0, 0xa9e6, 0xa9f6, 0x91fd, 0xc1e0},
+    {0x88d3, 0x6dc5, 0x6dc4, 0xedc5, 0xb722, 0x8000, 0x6dc5, 0xedc5, 0xb722, 0x8000},
+    {0x513c, 0x512f, 0x51b5, 0x4f50, 0x6300, 0x3f89, 0x51b6, 0x4f50, 0x6301, 0x3f8a},
+    {0x465f, 0x43e1, 0x4666, 0x4657, 0x4ac3, 0x41fd, 0x4666, 0x4658, 0x4ac4, 0x41fe},
+    {0xea8a, 0x6df8, 0x6df5, 0xedfa, 0xff80, 0xbc0e, 0x6df6, 0xedfa, 0xff80, 0xbc0e},
+    {0x9c7d, 0x0eca, 0x9c7c, 0x9c7d, 0x8000, 0xcd20, 0x9c7d, 0x9c7d, 0x8000, 0xcd20},
+    {0x493f, 0xcce7, 0xcce5, 0x4ce8, 0xd6ac, 0xbbd3, 0xcce6, 0x4ce8, 0xd6ac, 0xbbd4},
+    {0xe9de, 0xa536, 0xe9de, 0xe9dd, 0x4f9d, 0x7f80, 0xe9de, 0xe9de, 0x4f9e, 0x7f80},
+    {0xaed8, 0x2baf, 0xaed5, 0xaeda, 0x9b13, 0xc29d, 0xaed5, 0xaedb, 0x9b14, 0xc29e},
+    {0xf91c, 0xb3c8, 0xf91c, 0xf91b, 0x6d73, 0x7f80, 0xf91c, 0xf91c, 0x6d74, 0x7f80},
+    {0xc249, 0x430e, 0x42b7, 0xc340, 0xc5de, 0xbeb5, 0x42b8, 0xc340, 0xc5df, 0xbeb5},
+    {0xd68e, 0x504f, 0xd68d, 0xd68e, 0xe765, 0xc5af, 0xd68e, 0xd68e, 0xe766, 0xc5b0},
+    {0x3be1, 0xb9d6, 0x3bd3, 0x3bee, 0xb63c, 0xc186, 0x3bd4, 0x3bee, 0xb63c, 0xc187},
+    {0x82a6, 0xacad, 0xacad, 0x2cac, 0x0000, 0x1575, 0xacad, 0x2cad, 0x0000, 0x1576},
+    {0xd79a, 0xd950, 0xd963, 0x593c, 0x717a, 0x3dbd, 0xd963, 0x593d, 0x717a, 0x3dbe},
+    {0x6341, 0xe8a4, 0xe8a3, 0x68a4, 0xff80, 0xba16, 0xe8a4, 0x68a4, 0xff80, 0xba17},
+    {0x55c7, 0xd6c2, 0xd690, 0x56f3, 0xed16, 0xbe83, 0xd690, 0x56f4, 0xed17, 0xbe83},
+    {0xc87e, 0x1c8f, 0xc87d, 0xc87e, 0xa58d, 0xeb63, 0xc87e, 0xc87e, 0xa58e, 0xeb63},
+    {0x2d7e, 0x300f, 0x3012, 0xb00b, 0x1e0d, 0x3ce3, 0x3013, 0xb00b, 0x1e0e, 0x3ce3},
+    {0x84df, 0x935f, 0x935f, 0x135e, 0x0000, 0x3100, 0x935f, 0x135f, 0x0000, 0x3100},
+    {0xf29d, 0x704e, 0xf296, 0xf2a3, 0xff80, 0xc1c3, 0xf297, 0xf2a3, 0xff80, 0xc1c3},
+    {0x1329, 0x1e5f, 0x1e5f, 0x9e5e, 0x0000, 0x3442, 0x1e5f, 0x9e5f, 0x0000, 0x3442},
+    {0xebb4, 0x6af3, 0xeb6e, 0xebf0, 0xff80, 0xc03d, 0xeb6e, 0xebf1, 0xff80, 0xc03e},
+    {0x8265, 0xe5bd, 0xe5bd, 0x65bc, 0x28a9, 0x0000, 0xe5bd, 0x65bd, 0x28a9, 0x0000},
+    {0x1b3d, 0x9a50, 0x1b09, 0x1b71, 0x8000, 0xc068, 0x1b09, 0x1b71, 0x8000, 0xc069},
+    {0x29db, 0x7d65, 0x7d65, 0xfd64, 0x67c3, 0x0000, 0x7d65, 0xfd65, 0x67c4, 0x0000},
+    {0x9b74, 0x9e1a, 0x9e1d, 0x1e16, 0x0000, 0x3cca, 0x9e1e, 0x1e16, 0x0000, 0x3ccb},
+    {0x0dfd, 0x5dfe, 0x5dfe, 0xddfd, 0x2c7b, 0x0000, 0x5dfe, 0xddfe, 0x2c7b, 0x0000},
+    {0x987d, 0x167d, 0x986d, 0x9886, 0x8000, 0xc180, 0x986d, 0x9886, 0x8000, 0xc180},
+    {0x1b0f, 0xc1af, 0xc1ae, 0x41af, 0x9d43, 0x98d1, 0xc1af, 0x41af, 0x9d44, 0x98d1},
+    {0xa768, 0x2693, 0xa71e, 0xa798, 0x8e85, 0xc04a, 0xa71e, 0xa799, 0x8e85, 0xc04a},
+    {0x29e5, 0x6ae4, 0x6ae4, 0xeae3, 0x554b, 0x0008, 0x6ae4, 0xeae4, 0x554c, 0x0008},
+    {0x3f29, 0x3f47, 0x3fb8, 0xbdf0, 0x3f03, 0x3f59, 0x3fb8, 0xbdf0, 0x3f03, 0x3f59},
+    {0xb394, 0x6a6b, 0x6a6a, 0xea6b, 0xde87, 0x88a1, 0x6a6b, 0xea6b, 0xde88, 0x88a1},
+    {0x8e98, 0x91be, 0x91c0, 0x11bb, 0x0000, 0x3c4c, 0x91c0, 0x11bc, 0x0000, 0x3c4d},
+    {0x8cc0, 0xba7f, 0xba7f, 0x3a7e, 0x07bf, 0x11c0, 0xba7f, 0x3a7f, 0x07bf, 0x11c1},
+    {0x8f53, 0x1292, 0x1290, 0x9293, 0x8000, 0xbc38, 0x1290, 0x9294, 0x8000, 0xbc39},
+    {0xc4e2, 0x8980, 0xc4e2, 0xc4e1, 0x0ee2, 0x7ae2, 0xc4e2, 0xc4e2, 0x0ee2, 0x7ae2},
+    {0x41ec, 0xbd85, 0x41eb, 0x41ec, 0xbff5, 0xc3e3, 0x41eb, 0x41ed, 0xbff5, 0xc3e3},
+    {0x50ab, 0xb81a, 0x50aa, 0x50ab, 0xc94d, 0xd80e, 0x50ab, 0x50ab, 0xc94e, 0xd80e},
+    {0x7c2c, 0xfee6, 0xfee0, 0x7eeb, 0xff80, 0xbcbf, 0xfee1, 0x7eeb, 0xff80, 0xbcbf},
+    {0x54cb, 0x85a0, 0x54ca, 0x54cb, 0x9afd, 0xff80, 0x54cb, 0x54cb, 0x9afe, 0xff80},
+    {0x19b7, 0x1917, 0x1a01, 0x1957, 0x0000, 0x401b, 0x1a01, 0x1957, 0x0000, 0x401b},
+    {0x54c0, 0x29d7, 0x54c0, 0x54bf, 0x3f21, 0x6a64, 0x54c0, 0x54c0, 0x3f21, 0x6a65},
+    {0x9987, 0x9b29, 0x9b39, 0x1b18, 0x0000, 0x3dcc, 0x9b3a, 0x1b18, 0x0000, 0x3dcc},
+    {0xc676, 0x7e60, 0x7e5f, 0xfe60, 0xff80, 0x878c, 0x7e60, 0xfe60, 0xff80, 0x878d},
+    {0x9101, 0x8fe8, 0x911e, 0x90c8, 0x0000, 0x408e, 0x911e, 0x90c8, 0x0000, 0x408e},
+    {0xf39f, 0x4c7b, 0xf39e, 0xf39f, 0xff80, 0xe6a2, 0xf39f, 0xf39f, 0xff80, 0xe6a2},
+    {0x59fb, 0x5589, 0x59fb, 0x59fa, 0x7006, 0x43ea, 0x59fc, 0x59fa, 0x7006, 0x43eb},
+    {0x4c84, 0xb2d1, 0x4c83, 0x4c84, 0xbfd7, 0xd921, 0x4c84, 0x4c84, 0xbfd8, 0xd922},
+    {0xa5a4, 0xa4f1, 0xa5e0, 0xa54f, 0x0b1a, 0x402e, 0xa5e0, 0xa550, 0x0b1a, 0x402e},
+    {0x32d8, 0x591c, 0x591c, 0xd91b, 0x4c83, 0x1931, 0x591c, 0xd91c, 0x4c84, 0x1931},
+    {0xf21b, 0x742c, 0x7422, 0xf435, 0xff80, 0xbd66, 0x7422, 0xf436, 0xff80, 0xbd67},
+    {0xbaf1, 0x982e, 0xbaf1, 0xbaf0, 0x13a3, 0x6231, 0xbaf1, 0xbaf1, 0x13a4, 0x6231},
+    {0x1469, 0x9667, 0x9658, 0x1675, 0x8000, 0xbd81, 0x9658, 0x1676, 0x8000, 0xbd81},
+    {0x5609, 0x670d, 0x670d, 0xe70c, 0x7d96, 0x2e78, 0x670d, 0xe70d, 0x7d97, 0x2e79},
+    {0x0d0f, 0x0d4e, 0x0dae, 0x8c7c, 0x0000, 0x3f31, 0x0dae, 0x8c7c, 0x0000, 0x3f32},
+    {0x571b, 0x01cd, 0x571b, 0x571a, 0x1978, 0x7f80, 0x571b, 0x571b, 0x1978, 0x7f80},
+    {0x330c, 0xb5e2, 0xb5dd, 0x35e6, 0xa977, 0xbc9e, 0xb5de, 0x35e6, 0xa977, 0xbc9f},
+    {0xccdd, 0x5f34, 0x5f33, 0xdf34, 0xec9b, 0xad1d, 0x5f34, 0xdf34, 0xec9b, 0xad1d},
+    {0xfeca, 0x7b4e, 0xfec8, 0xfecb, 0xff80, 0xc2fb, 0xfec8, 0xfecc, 0xff80, 0xc2fb},
+    {0xe8bd, 0x2869, 0xe8bc, 0xe8bd, 0xd1ac, 0xff80, 0xe8bd, 0xe8bd, 0xd1ac, 0xff80},
+    {0x0242, 0x84b6, 0x84af, 0x04bc, 0x8000, 0xbd08, 0x84b0, 0x04bc, 0x8000, 0xbd08},
+    {0x420c, 0xd264, 0xd263, 0x5264, 0xd4f9, 0xaf1d, 0xd264, 0x5264, 0xd4f9, 0xaf1d},
+    {0x0cde, 0x1018, 0x1019, 0x9016, 0x0000, 0x3c3a, 0x101a, 0x9016, 0x0000, 0x3c3b},
+    {0xbca9, 0xc7ed, 0xc7ed, 0x47ec, 0x451c, 0x3436, 0xc7ed, 0x47ed, 0x451c, 0x3437},
+    {0x3635, 0x326c, 0x3635, 0x3634, 0x2926, 0x4344, 0x3636, 0x3634, 0x2927, 0x4344},
+    {0xd555, 0x7f5e, 0x7f5d, 0xff5e, 0xff80, 0x9575, 0x7f5e, 0xff5e, 0xff80, 0x9576},
+    {0xd24f, 0x4ff0, 0xd247, 0xd256, 0xe2c2, 0xc1dc, 0xd248, 0xd256, 0xe2c2, 0xc1dd},
+    {0xcbd7, 0xaa24, 0xcbd7, 0xcbd6, 0x3689, 0x6127, 0xcbd7, 0xcbd7, 0x368a, 0x6128},
+    {0x7d78, 0x7a98, 0x7d7c, 0x7d73, 0x7f80, 0x4250, 0x7d7d, 0x7d73, 0x7f80, 0x4251},
+    {0xb265, 0x1130, 0xb264, 0xb265, 0x841d, 0xe0a6, 0xb265, 0xb265, 0x841d, 0xe0a7},
+    {0x2abb, 0xae7e, 0xae7c, 0x2e7f, 0x99b9, 0xbbbc, 0xae7d, 0x2e7f, 0x99ba, 0xbbbc},
+    {0x4a16, 0x94d9, 0x4a15, 0x4a16, 0x9f7e, 0xf4b0, 0x4a16, 0x4a16, 0x9f7e, 0xf4b1},
+    {0x4fbb, 0x4be1, 0x4fbb, 0x4fba, 0x5c24, 0x4354, 0x4fbc, 0x4fba, 0x5c24, 0x4355},
+    {0xac1b, 0xa06f, 0xac1b, 0xac1a, 0x0d10, 0x4b26, 0xac1b, 0xac1b, 0x0d11, 0x4b26},
+    {0x3b4d, 0xb7f0, 0x3b4b, 0x3b4e, 0xb3c0, 0xc2da, 0x3b4b, 0x3b4f, 0xb3c0, 0xc2db},
+    {0xa21d, 0xd5ba, 0xd5ba, 0x55b9, 0x3864, 0x0bd8, 0xd5ba, 0x55ba, 0x3864, 0x0bd8},
+    {0x1ec1, 0x9d51, 0x1ea6, 0x1edb, 0x8000, 0xc0ec, 0x1ea7, 0x1edb, 0x8001, 0xc0ec},
+    {0x9e78, 0xb44d, 0xb44d, 0x344c, 0x1346, 0x299a, 0xb44d, 0x344d, 0x1347, 0x299b},
+    {0x2a99, 0xaad1, 0xa9e0, 0x2b35, 0x95f9, 0xbf3b, 0xa9e0, 0x2b35, 0x95fa, 0xbf3b},
+    {0x3e72, 0x7b72, 0x7b72, 0xfb71, 0x7a64, 0x0280, 0x7b72, 0xfb72, 0x7a65, 0x0280},
+    {0x65ac, 0xe8b0, 0xe8ad, 0x68b2, 0xff80, 0xbc7a, 0xe8ad, 0x68b3, 0xff80, 0xbc7a},
+    {0x562d, 0x3092, 0x562d, 0x562c, 0x4745, 0x6517, 0x562d, 0x562d, 0x4745, 0x6518},
+    {0xabc6, 0x2e2e, 0x2e27, 0xae34, 0x9a86, 0xbd11, 0x2e28, 0xae34, 0x9a87, 0xbd12},
+    {0xf92f, 0xe818, 0xf92f, 0xf92e, 0x7f80, 0x5093, 0xf92f, 0xf92f, 0x7f80, 0x5093},
+    {0x3491, 0x3091, 0x3491, 0x3490, 0x25a4, 0x4380, 0x3492, 0x3490, 0x25a4, 0x4380},
+    {0x8678, 0x93c5, 0x93c5, 0x13c4, 0x0000, 0x3221, 0x93c5, 0x13c5, 0x0000, 0x3221},
+    {0x685d, 0x6658, 0x686a, 0x684f, 0x7f80, 0x4182, 0x686a, 0x6850, 0x7f80, 0x4183},
+    {0xfc74, 0x8714, 0xfc74, 0xfc73, 0x440d, 0x7f80, 0xfc74, 0xfc74, 0x440d, 0x7f80},
+    {0x7719, 0x7454, 0x771c, 0x7715, 0x7f80, 0x4238, 0x771c, 0x7716, 0x7f80, 0x4239},
+    {0x60f4, 0x7ad8, 0x7ad8, 0xfad7, 0x7f80, 0x2590, 0x7ad8, 0xfad8, 0x7f80, 0x2591},
+    {0xa977, 0xac1d, 0xac20, 0x2c19, 0x1617, 0x3cc9, 0xac21, 0x2c19, 0x1617, 0x3cc9},
+    {0x5831, 0xc9bd, 0x5830, 0x5831, 0xe282, 0xcdef, 0x5831, 0x5831, 0xe283, 0xcdf0},
+    {0x64ec, 0x6652, 0x666f, 0xe634, 0x7f80, 0x3e0f, 0x6670, 0xe634, 0x7f80, 0x3e10},
+    {0x5803, 0x98ab, 0x5802, 0x5803, 0xb12f, 0xfec4, 0x5803, 0x5803, 0xb12f, 0xfec4},
+    {0x7b16, 0xfa43, 0x7aca, 0x7b46, 0xff80, 0xc044, 0x7aca, 0x7b47, 0xff80, 0xc045},
+    {0xcdfa, 0xb46b, 0xcdfa, 0xcdf9, 0x42e5, 0x5908, 0xcdfa, 0xcdfa, 0x42e5, 0x5908},
+    {0x8910, 0x07c9, 0x88ed, 0x8929, 0x8000, 0xc0b7, 0x88ee, 0x8929, 0x8000, 0xc0b7},
+    {0xd9a2, 0x8f02, 0xd9a2, 0xd9a1, 0x2924, 0x7f80, 0xd9a2, 0xd9a2, 0x2925, 0x7f80},
+    {0x8499, 0x02e8, 0x848a, 0x84a7, 0x8000, 0xc128, 0x848a, 0x84a8, 0x8000, 0xc129},
+    {0x12d3, 0x0edf, 0x12d3, 0x12d2, 0x0000, 0x4372, 0x12d4, 0x12d2, 0x0000, 0x4372},
+    {0x96b1, 0x16a5, 0x94c0, 0x972b, 0x8000, 0xbf89, 0x94c0, 0x972b, 0x8000, 0xbf89},
+    {0x3e00, 0x9f8f, 0x3dff, 0x3e00, 0x9e0f, 0xdde5, 0x3e00, 0x3e00, 0x9e0f, 0xdde5},
+    {0x46c7, 0x48af, 0x48bb, 0xc8a2, 0x5008, 0x3d91, 0x48bb, 0xc8a3, 0x5008, 0x3d92},
+    {0xd8a6, 0x859f, 0xd8a6, 0xd8a5, 0x1ece, 0x7f80, 0xd8a6, 0xd8a6, 0x1ece, 0x7f80},
+    {0xdb83, 0xddef, 0xddf7, 0x5de6, 0x79f4, 0x3d0c, 0xddf7, 0x5de7, 0x79f5, 0x3d0c},
+    {0x3ebe, 0x3ee6, 0x3f52, 0xbda0, 0x3e2a, 0x3f53, 0x3f52, 0xbda0, 0x3e2b, 0x3f53},
+    {0xc6e6, 0xc681, 0xc733, 0xc64a, 0x4de7, 0x3fe4, 0xc734, 0xc64a, 0x4de8, 0x3fe4},
+    {0x0951, 0xb8ae, 0xb8ad, 0x38ae, 0x828e, 0x9019, 0xb8ae, 0x38ae, 0x828e, 0x901a},
+    {0xa7f3, 0x2b06, 0x2b04, 0xab07, 0x937e, 0xbc68, 0x2b04, 0xab08, 0x937e, 0xbc68},
+    {0x21b5, 0xe97c, 0xe97b, 0x697c, 0xcbb2, 0x8000, 0xe97c, 0x697c, 0xcbb2, 0x8000},
+    {0x5510, 0xd89c, 0xd89a, 0x589d, 0xee2f, 0xbbec, 0xd89b, 0x589d, 0xee30, 0xbbec},
+    {0x010d, 0x5eb7, 0x5eb7, 0xdeb6, 0x2049, 0x0000, 0x5eb7, 0xdeb7, 0x204a, 0x0000},
+    {0x3686, 0x37c9, 0x37ea, 0xb7a7, 0x2ed2, 0x3e2a, 0x37ea, 0xb7a8, 0x2ed2, 0x3e2b},
+    {0x4293, 0xf2a9, 0xf2a8, 0x72a9, 0xf5c2, 0x8f5e, 0xf2a9, 0x72a9, 0xf5c2, 0x8f5f},
+    {0xb22e, 0xb092, 0xb240, 0xb21b, 0x2346, 0x4118, 0xb240, 0xb21c, 0x2346, 0x4119},
+    {0xe8e9, 0x8e42, 0xe8e9, 0xe8e8, 0x37b0, 0x7f80, 0xe8e9, 0xe8e9, 0x37b1, 0x7f80},
+    {0x8986, 0x8b2b, 0x8b3b, 0x0b1a, 0x0000, 0x3dc8, 0x8b3c, 0x0b1a, 0x0000, 0x3dc9},
+    {0xd3d6, 0x6505, 0x6504, 0xe505, 0xf95e, 0xae4d, 0x6505, 0xe505, 0xf95e, 0xae4e},
+    {0xf149, 0x6f90, 0xf137, 0xf15b, 0xff80, 0xc132, 0xf137, 0xf15b, 0xff80, 0xc133},
+    {0xcffe, 0xfbee, 0xfbee, 0x7bed, 0x7f80, 0x1388, 0xfbee, 0x7bee, 0x7f80, 0x1389},
+    {0xc036, 0x4232, 0x4226, 0xc23d, 0xc2fd, 0xbd82, 0x4227, 0xc23d, 0xc2fd, 0xbd83},
+    {0x92cd, 0x7dcd, 0x7dcc, 0xfdcd, 0xd124, 0x8000, 0x7dcd, 0xfdcd, 0xd124, 0x8000},
+    {0xf5e7, 0x749e, 0xf5bf, 0xf607, 0xff80, 0xc0bb, 0xf5c0, 0xf607, 0xff80, 0xc0bb},
+    {0xe2ee, 0x3db0, 0xe2ed, 0xe2ee, 0xe123, 0xe4ad, 0xe2ee, 0xe2ee, 0xe124, 0xe4ad},
+    {0x7118, 0x734b, 0x7354, 0xf341, 0x7f80, 0x3d3f, 0x7354, 0xf342, 0x7f80, 0x3d40},
+    {0x1e06, 0xcc4c, 0xcc4b, 0x4c4c, 0xaad5, 0x9128, 0xcc4c, 0x4c4c, 0xaad6, 0x9128},
+    {0xc1c0, 0xc013, 0xc1d2, 0xc1ad, 0x425c, 0x4127, 0xc1d2, 0xc1ae, 0x425c, 0x4127},
+    {0xedfd, 0x7675, 0x7674, 0xf675, 0xff80, 0xb704, 0x7675, 0xf675, 0xff80, 0xb704},
+    {0x2b18, 0xae0f, 0xae0c, 0x2e11, 0x99a9, 0xbc88, 0xae0d, 0x2e11, 0x99aa, 0xbc88},
+    {0xf08a, 0x10f0, 0xf089, 0xf08a, 0xc201, 0xff80, 0xf08a, 0xf08a, 0xc201, 0xff80},
+    {0x48ba, 0xc9d7, 0xc9a8, 0x4a02, 0xd31c, 0xbe5d, 0xc9a8, 0x4a03, 0xd31c, 0xbe5d},
+    {0x775a, 0x943f, 0x7759, 0x775a, 0xcc22, 0xff80, 0x775a, 0x775a, 0xcc23, 0xff80},
+    {0x4c30, 0x4cd5, 0x4d16, 0xcc7a, 0x5992, 0x3ed3, 0x4d16, 0xcc7a, 0x5992, 0x3ed4},
+    {0x28ff, 0xc864, 0xc863, 0x4864, 0xb1e3, 0xa00f, 0xc864, 0x4864, 0xb1e3, 0xa00f},
+    {0x2602, 0xa286, 0x2600, 0x2603, 0x8908, 0xc2f8, 0x2601, 0x2603, 0x8908, 0xc2f8},
+    {0xf1f1, 0x4131, 0xf1f0, 0xf1f1, 0xf3a6, 0xf02e, 0xf1f1, 0xf1f1, 0xf3a7, 0xf02e},
+    {0x20b6, 0x9ef2, 0x20a6, 0x20c5, 0x8056, 0xc140, 0x20a7, 0x20c5, 0x8056, 0xc141},
+    {0x006a, 0x3b69, 0x3b69, 0xbb68, 0x0000, 0x0468, 0x3b69, 0xbb69, 0x0000, 0x0469},
+    {0xf6d8, 0x746d, 0xf6d0, 0xf6df, 0xff80, 0xc1e9, 0xf6d1, 0xf6df, 0xff80, 0xc1e9},
+    {0x8e13, 0xe0b0, 0xe0b0, 0x60af, 0x2f4a, 0x0000, 0xe0b0, 0x60b0, 0x2f4a, 0x0000},
+    {0x43ea, 0xc1a0, 0x43e0, 0x43f4, 0xc612, 0xc1bb, 0x43e0, 0x43f4, 0xc612, 0xc1bb},
+    {0xeeb0, 0x2df7, 0xeeaf, 0xeeb0, 0xdd29, 0xff80, 0xeeb0, 0xeeb0, 0xdd2a, 0xff80},
+    {0x52a0, 0xcf91, 0x529d, 0x52a2, 0xe2b5, 0xc28d, 0x529e, 0x52a2, 0xe2b5, 0xc28d},
+    {0x22ae, 0x8e41, 0x22ad, 0x22ae, 0x8000, 0xd3e6, 0x22ae, 0x22ae, 0x8000, 0xd3e7},
+    {0x4324, 0xc282, 0x42c6, 0x4365, 0xc626, 0xc021, 0x42c6, 0x4365, 0xc627, 0xc021},
+    {0x0ef6, 0x4343, 0x4343, 0xc342, 0x12bb, 0x0b21, 0x4343, 0xc343, 0x12bb, 0x0b21},
+    {0x28b8, 0x24a6, 0x28b8, 0x28b7, 0x0dee, 0x438d, 0x28b9, 0x28b7, 0x0def, 0x438e},
+    {0xf565, 0x0fa2, 0xf564, 0xf565, 0xc590, 0xff80, 0xf565, 0xf565, 0xc591, 0xff80},
+    {0xc1a2, 0x41c1, 0x4078, 0xc231, 0xc3f4, 0xbf56, 0x4078, 0xc232, 0xc3f4, 0xbf57},
+    {0xa6b5, 0xc6de, 0xc6de, 0x46dd, 0x2e1c, 0x1f50, 0xc6de, 0x46de, 0x2e1d, 0x1f51},
+    {0xf991, 0x7b89, 0x7b7f, 0xfb92, 0xff80, 0xbd87, 0x7b80, 0xfb92, 0xff80, 0xbd87},
+    {0xc3af, 0x3876, 0xc3ae, 0xc3af, 0xbca8, 0xcab6, 0xc3af, 0xc3af, 0xbca8, 0xcab6},
+    {0x266e, 0xa869, 0xa85a, 0x2877, 0x8f58, 0xbd82, 0xa85a, 0x2878, 0x8f59, 0xbd83},
+    {0x983d, 0xd83e, 0xd83e, 0x583d, 0x310c, 0x001f, 0xd83e, 0x583e, 0x310c, 0x0020},
+    {0x8981, 0x089e, 0x8933, 0x89a8, 0x8000, 0xc051, 0x8933, 0x89a8, 0x8000, 0xc051},
+    {0xc693, 0x5311, 0x5310, 0xd311, 0xda26, 0xb301, 0x5311, 0xd311, 0xda27, 0xb302},
+    {0xfd32, 0x7db1, 0x7d30, 0xfe05, 0xff80, 0xbf00, 0x7d30, 0xfe05, 0xff80, 0xbf01},
+    {0x6289, 0x1b53, 0x6289, 0x6288, 0x3e61, 0x7f80, 0x6289, 0x6289, 0x3e62, 0x7f80},
+    {0x5808, 0xdb4d, 0xdb4a, 0x5b4f, 0xf3d9, 0xbc29, 0xdb4b, 0x5b4f, 0xf3da, 0xbc2a},
+    {0x7772, 0x9293, 0x7771, 0x7772, 0xca8a, 0xff80, 0x7772, 0x7772, 0xca8b, 0xff80},
+    {0x60cc, 0x61d4, 0x6203, 0xe1a1, 0x7f80, 0x3e76, 0x6204, 0xe1a1, 0x7f80, 0x3e76},
+    {0x8093, 0xef58, 0xef58, 0x6f57, 0x3078, 0x0000, 0xef58, 0x6f58, 0x3078, 0x0000},
+    {0x79f6, 0x7819, 0x7a04, 0x79e2, 0x7f80, 0x414d, 0x7a05, 0x79e3, 0x7f80, 0x414e},
+    {0x61b0, 0xe199, 0x6038, 0x6224, 0xff80, 0xbf93, 0x6038, 0x6224, 0xff80, 0xbf93},
+    {0xeb87, 0x6bcf, 0x6b10, 0xec2b, 0xff80, 0xbf26, 0x6b10, 0xec2b, 0xff80, 0xbf27},
+    {0xa792, 0x1d36, 0xa791, 0xa792, 0x854f, 0xc9cd, 0xa792, 0xa792, 0x8550, 0xc9cd},
+    {0xed70, 0xefd4, 0xefdb, 0x6fcc, 0x7f80, 0x3d10, 0xefdc, 0x6fcc, 0x7f80, 0x3d11},
+    {0x6237, 0x5a7b, 0x6237, 0x6236, 0x7d33, 0x473a, 0x6237, 0x6237, 0x7d33, 0x473b},
+    {0xbc09, 0xbf0e, 0xbf10, 0x3f0b, 0x3b97, 0x3c76, 0xbf10, 0x3f0c, 0x3b98, 0x3c77},
+    {0xc07d, 0x6ed0, 0x6ecf, 0xeed0, 0xefcd, 0x911b, 0x6ed0, 0xeed0, 0xefce, 0x911c},
+    {0x3952, 0xbbb4, 0xbbad, 0x3bba, 0xb593, 0xbd15, 0xbbad, 0x3bbb, 0xb594, 0xbd15},
+    {0xe00b, 0xb0a5, 0xe00b, 0xe00a, 0x5133, 0x6ed7, 0xe00b, 0xe00b, 0x5133, 0x6ed8},
+    {0x4d79, 0xcb34, 0x4d6d, 0x4d82, 0xd92f, 0xc1b1, 0x4d6e, 0x4d82, 0xd92f, 0xc1b1},
+    {0xd0fc, 0xcab6, 0xd0fc, 0xd0fb, 0x5c33, 0x45b1, 0xd0fc, 0xd0fc, 0x5c33, 0x45b1},
+    {0x4da8, 0x4b02, 0x4dac, 0x4da3, 0x592a, 0x4225, 0x4dac, 0x4da4, 0x592b, 0x4225},
+    {0x1503, 0xa567, 0xa566, 0x2567, 0x8000, 0xaf11, 0xa567, 0x2567, 0x8000, 0xaf11},
+    {0x8ae0, 0x8aad, 0x8b46, 0x89cc, 0x0000, 0x3fa5, 0x8b46, 0x89cc, 0x0000, 0x3fa6},
+    {0xe735, 0x15f1, 0xe734, 0xe735, 0xbdaa, 0xff80, 0xe735, 0xe735, 0xbdaa, 0xff80},
+    {0x247e, 0x23fd, 0x24be, 0x23ff, 0x08fb, 0x4000, 0x24be, 0x23ff, 0x08fb, 0x4001},
+    {0xa7e7, 0xd048, 0xd048, 0x5047, 0x38b4, 0x1713, 0xd048, 0x5048, 0x38b4, 0x1714},
+    {0x921d, 0x1030, 0x9212, 0x9228, 0x8000, 0xc164, 0x9212, 0x9228, 0x8000, 0xc164},
+    {0x7c06, 0xfc79, 0xfbe6, 0x7cbf, 0xff80, 0xbf09, 0xfbe6, 0x7cc0, 0xff80, 0xbf0a},
+    {0x6aba, 0xe6c3, 0x6ab9, 0x6aba, 0xff80, 0xc374, 0x6ab9, 0x6abb, 0xff80, 0xc374},
+    {0x9a99, 0x21f6, 0x21f5, 0xa1f6, 0x8001, 0xb81f, 0x21f6, 0xa1f6, 0x8001, 0xb81f},
+    {0xbaab, 0xbe1d, 0xbe1e, 0x3e1b, 0x3951, 0x3c0b, 0xbe1e, 0x3e1c, 0x3952, 0x3c0b},
+    {0x99f8, 0x2fc7, 0x2fc6, 0xafc7, 0x8a40, 0xa99f, 0x2fc7, 0xafc7, 0x8a41, 0xa9a0},
+    {0x0704, 0x06e6, 0x0777, 0x0588, 0x0000, 0x3f92, 0x0777, 0x0588, 0x0000, 0x3f93},
+    {0x3b2e, 0x034e, 0x3b2e, 0x3b2d, 0x0011, 0x7758, 0x3b2e, 0x3b2e, 0x0012, 0x7758},
+    {0xbe5b, 0x3b58, 0xbe57, 0xbe5e, 0xba38, 0xc281, 0xbe58, 0xbe5e, 0xba39, 0xc282},
+    {0x0a71, 0xeee7, 0xeee6, 0x6ee7, 0xb9d9, 0x8000, 0xeee7, 0x6ee7, 0xb9d9, 0x8000},
+    {0x9905, 0x968c, 0x9909, 0x9900, 0x0000, 0x41f3, 0x9909, 0x9901, 0x0000, 0x41f3},
+    {0xf91e, 0xb1af, 0xf91e, 0xf91d, 0x6b58, 0x7f80, 0xf91e, 0xf91e, 0x6b58, 0x7f80},
+    {0xd558, 0xd60f, 0xd645, 0x55b2, 0x6bf1, 0x3ec1, 0xd645, 0x55b2, 0x6bf1, 0x3ec1},
+    {0xd87a, 0xafc6, 0xd87a, 0xd879, 0x48c1, 0x6821, 0xd87a, 0xd87a, 0x48c1, 0x6822},
+    {0xe1de, 0xe47d, 0xe481, 0x6476, 0x7f80, 0x3ce0, 0xe482, 0x6476, 0x7f80, 0x3ce1},
+    {0xd617, 0x164d, 0xd616, 0xd617, 0xacf1, 0xff3c, 0xd617, 0xd617, 0xacf2, 0xff3d},
+    {0x6a50, 0x6863, 0x6a5e, 0x6a41, 0x7f80, 0x416a, 0x6a5e, 0x6a42, 0x7f80, 0x416b},
+    {0xade8, 0xff6f, 0xff6f, 0x7f6e, 0x6dd8, 0x0000, 0xff6f, 0x7f6f, 0x6dd9, 0x0000},
+    {0xb8a1, 0x3887, 0xb750, 0xb914, 0xb1a9, 0xbf98, 0xb750, 0xb914, 0xb1aa, 0xbf99},
+    {0x799b, 0x25d3, 0x799b, 0x799a, 0x5fff, 0x7f80, 0x799b, 0x799b, 0x6000, 0x7f80},
+    {0xa18b, 0x1de7, 0xa18a, 0xa18b, 0x803e, 0xc31a, 0xa18a, 0xa18c, 0x803f, 0xc31a},
+    {0xbfee, 0x1e03, 0xbfed, 0xbfee, 0x9e73, 0xe168, 0xbfee, 0xbfee, 0x9e74, 0xe169},
+    {0x2931, 0x29b7, 0x2a07, 0xa93d, 0x137d, 0x3ef7, 0x2a08, 0xa93d, 0x137d, 0x3ef8},
+    {0x54dd, 0x80cf, 0x54dc, 0x54dd, 0x9632, 0xff80, 0x54dd, 0x54dd, 0x9633, 0xff80},
+    {0xff17, 0x7b4c, 0xff16, 0xff17, 0xff80, 0xc33d, 0xff16, 0xff18, 0xff80, 0xc33d},
+    {0x079b, 0x8e35, 0x8e34, 0x0e35, 0x8000, 0xb8db, 0x8e35, 0x0e35, 0x8000, 0xb8db},
+    {0x6ff8, 0xed08, 0x6ff3, 0x6ffc, 0xff80, 0xc269, 0x6ff4, 0x6ffc, 0xff80, 0xc269},
+    {0x9c2f, 0xc47d, 0xc47d, 0x447c, 0x212c, 0x1731, 0xc47d, 0x447d, 0x212d, 0x1731},
+    {0xbdb3, 0xb9f0, 0xbdb3, 0xbdb2, 0x3827, 0x433e, 0xbdb4, 0xbdb2, 0x3828, 0x433f},
+    {0x7dbb, 0x5f42, 0x7dbb, 0x7dba, 0x7f80, 0x5df6, 0x7dbb, 0x7dbb, 0x7f80, 0x5df7},
+    {0xade1, 0x2bd7, 0xadd3, 0xadee, 0x9a3c, 0xc185, 0xadd4, 0xadee, 0x9a3d, 0xc186},
+    {0xb017, 0x202a, 0xb016, 0xb017, 0x90c8, 0xcf63, 0xb017, 0xb017, 0x90c9, 0xcf63},
+    {0x0b63, 0x8aa5, 0x0b10, 0x0b9a, 0x8000, 0xc030, 0x0b10, 0x0b9b, 0x8000, 0xc030},
+    {0x025f, 0x3807, 0x3807, 0xb806, 0x0000, 0x09d3, 0x3807, 0xb807, 0x0000, 0x09d3},
+    {0x4159, 0xbe5d, 0x4155, 0x415c, 0xc03b, 0xc27b, 0x4156, 0x415c, 0xc03b, 0xc27b},
+    {0x48a2, 0xba3b, 0x48a1, 0x48a2, 0xc36c, 0xcddd, 0x48a2, 0x48a2, 0xc36d, 0xcdde},
+    {0x4795, 0xca43, 0xca3e, 0x4a47, 0xd262, 0xbcc3, 0xca3e, 0x4a48, 0xd263, 0xbcc4},
+    {0xab5f, 0x6f82, 0x6f81, 0xef82, 0xdb62, 0x8000, 0x6f82, 0xef82, 0xdb62, 0x8000},
+    {0x934b, 0x1643, 0x163f, 0x9646, 0x8000, 0xbc85, 0x1640, 0x9646, 0x8000, 0xbc85},
+    {0xd6a1, 0x2e7e, 0xd6a0, 0xd6a1, 0xc59f, 0xe7a2, 0xd6a1, 0xd6a1, 0xc5a0, 0xe7a2},
+    {0x1274, 0x157b, 0x157e, 0x9577, 0x0000, 0x3c78, 0x157f, 0x9577, 0x0000, 0x3c79},
+    {0x33eb, 0xb086, 0x33e8, 0x33ed, 0xa4f6, 0xc2e0, 0x33e9, 0x33ed, 0xa4f6, 0xc2e0},
+    {0x7a56, 0xfa16, 0x7980, 0x7ab6, 0xff80, 0xbfb6, 0x7980, 0x7ab6, 0xff80, 0xbfb7},
+    {0xe5dd, 0x19df, 0xe5dc, 0xe5dd, 0xc040, 0xff80, 0xe5dd, 0xe5dd, 0xc041, 0xff80},
+    {0xda8f, 0x59e2, 0xda2d, 0xdac7, 0xf4fc, 0xc021, 0xda2d, 0xdac8, 0xf4fc, 0xc022},
+    {0x024d, 0x5308, 0x5308, 0xd307, 0x15d9, 0x0000, 0x5308, 0xd308, 0x15da, 0x0000},
+    {0xf64d, 0x72f0, 0xf64b, 0xf64e, 0xff80, 0xc2da, 0xf64b, 0xf64f, 0xff80, 0xc2db},
+    {0xf0d2, 0xa0b3, 0xf0d2, 0xf0d1, 0x5212, 0x7f80, 0xf0d2, 0xf0d2, 0x5213, 0x7f80},
+    {0x2f46, 0x3092, 0x30aa, 0xb072, 0x2061, 0x3e2d, 0x30ab, 0xb072, 0x2062, 0x3e2e},
+    {0xa49b, 0xc1db, 0xc1db, 0x41da, 0x2704, 0x2235, 0xc1db, 0x41db, 0x2705, 0x2235},
+    {0x59df, 0x5d5b, 0x5d5c, 0xdd59, 0x77be, 0x3c02, 0x5d5d, 0xdd59, 0x77bf, 0x3c02},
+    {0xb72f, 0xd2ac, 0xd2ac, 0x52ab, 0x4a6b, 0x2402, 0xd2ac, 0x52ac, 0x4a6b, 0x2402},
+    {0xd46b, 0xd767, 0xd76a, 0x5763, 0x6c54, 0x3c82, 0xd76b, 0x5763, 0x6c54, 0x3c82},
+    {0x1444, 0x07a5, 0x1444, 0x1443, 0x0000, 0x4c18, 0x1444, 0x1444, 0x0000, 0x4c18},
+    {0x1c92, 0x1915, 0x1c93, 0x1c90, 0x0000, 0x42fa, 0x1c93, 0x1c91, 0x0000, 0x42fb},
+    {0x0211, 0xd610, 0xd60f, 0x5610, 0x98a3, 0x8000, 0xd610, 0x5610, 0x98a3, 0x8000},
+    {0x6e38, 0x6d1b, 0x6e5e, 0x6e11, 0x7f80, 0x4097, 0x6e5f, 0x6e11, 0x7f80, 0x4098},
+    {0x3e7c, 0xe154, 0xe153, 0x6154, 0xe050, 0x9c98, 0xe154, 0x6154, 0xe051, 0x9c98},
+    {0x2b11, 0xa9ea, 0x2ae7, 0x2b2e, 0x9584, 0xc09e, 0x2ae8, 0x2b2e, 0x9585, 0xc09f},
+    {0xbd89, 0x75ad, 0x75ac, 0xf5ad, 0xf3b9, 0x874a, 0x75ad, 0xf5ad, 0xf3b9, 0x874b},
+    {0x6c67, 0xe803, 0x6c66, 0x6c67, 0xff80, 0xc3e1, 0x6c66, 0x6c68, 0xff80, 0xc3e2},
+    {0xf43e, 0x1cad, 0xf43d, 0xf43e, 0xd180, 0xff80, 0xf43e, 0xf43e, 0xd180, 0xff80},
+    {0xc04b, 0xc266, 0xc272, 0x4259, 0x4336, 0x3d61, 0xc273, 0x4259, 0x4336, 0x3d62},
+    {0x0bd7, 0x8862, 0x0bd5, 0x0bd8, 0x8000, 0xc2f3, 0x0bd5, 0x0bd9, 0x8000, 0xc2f4},
+    {0x643b, 0xe609, 0xe5fa, 0x6614, 0xff80, 0xbdae, 0xe5fb, 0x6615, 0xff80, 0xbdaf},
+    {0x5192, 0x8df8, 0x5191, 0x5192, 0xa00d, 0xff80, 0x5192, 0x5192, 0xa00d, 0xff80},
+    {0x1c97, 0x1f80, 0x1f82, 0x9f7b, 0x0000, 0x3c97, 0x1f82, 0x9f7b, 0x0001, 0x3c97},
+    {0xcaa6, 0x6151, 0x6150, 0xe151, 0xec87, 0xa8cb, 0x6151, 0xe151, 0xec88, 0xa8cb},
+    {0xf224, 0x7121, 0xf1f7, 0xf24c, 0xff80, 0xc082, 0xf1f8, 0xf24c, 0xff80, 0xc082},
+    {0xa129, 0xf0cb, 0xf0cb, 0x70ca, 0x5286, 0x0000, 0xf0cb, 0x70cb, 0x5286, 0x0000},
+    {0xa89e, 0x2ab6, 0x2aac, 0xaabf, 0x93e0, 0xbd5e, 0x2aac, 0xaac0, 0x93e1, 0xbd5e},
+    {0xe17e, 0xbfc3, 0xe17e, 0xe17d, 0x61c1, 0x6126, 0xe17e, 0xe17e, 0x61c1, 0x6127},
+    {0x5188, 0xcee4, 0x5184, 0x518b, 0xe0f2, 0xc218, 0x5184, 0x518c, 0xe0f2, 0xc219},
+    {0x0f22, 0x190c, 0x190c, 0x990b, 0x0000, 0x3594, 0x190c, 0x990c, 0x0000, 0x3594},
+    {0x6996, 0xeb68, 0xeb55, 0x6b7a, 0xff80, 0xbda5, 0xeb55, 0x6b7b, 0xff80, 0xbda6},
+    {0xc051, 0x4355, 0x4351, 0xc358, 0xc42d, 0xbc7b, 0x4352, 0xc358, 0xc42e, 0xbc7b},
+    {0x223e, 0xa3ac, 0xa394, 0x23c3, 0x867f, 0xbe0d, 0xa394, 0x23c4, 0x867f, 0xbe0d},
+    {0xd5b2, 0xe3c6, 0xe3c6, 0x63c5, 0x7a09, 0x3166, 0xe3c6, 0x63c6, 0x7a0a, 0x3166},
+    {0xa84a, 0x2b61, 0x2b5d, 0xab64, 0x9431, 0xbc65, 0x2b5e, 0xab64, 0x9432, 0xbc66},
+    {0xd1ae, 0x21ab, 0xd1ad, 0xd1ae, 0xb3e8, 0xef82, 0xd1ae, 0xd1ae, 0xb3e8, 0xef82},
+    {0xb041, 0x30d9, 0x3071, 0xb11c, 0xa1a3, 0xbee3, 0x3071, 0xb11d, 0xa1a4, 0xbee4},
+    {0xf4dc, 0xdf48, 0xf4dc, 0xf4db, 0x7f80, 0x550c, 0xf4dc, 0xf4dc, 0x7f80, 0x550d},
+    {0x9295, 0x90b1, 0x92a0, 0x9289, 0x0000, 0x4157, 0x92a0, 0x928a, 0x0000, 0x4158},
+    {0x484e, 0x1c7a, 0x484e, 0x484d, 0x2549, 0x6b52, 0x484e, 0x484e, 0x2549, 0x6b53},
+    {0xfc17, 0xfa87, 0xfc27, 0xfc06, 0x7f80, 0x410f, 0xfc28, 0xfc06, 0x7f80, 0x410f},
+    {0x2689, 0x99b2, 0x2688, 0x2689, 0x80be, 0xcc45, 0x2689, 0x2689, 0x80bf, 0xcc45},
+    {0x6f38, 0x710e, 0x7119, 0xf102, 0x7f80, 0x3da5, 0x711a, 0xf102, 0x7f80, 0x3da6},
+    {0xcd47, 0x9809, 0xcd47, 0xcd46, 0x25d4, 0x74b9, 0xcd47, 0xcd47, 0x25d5, 0x74ba},
+    {0xcf77, 0xce8e, 0xcf9f, 0xcf30, 0x5e89, 0x405e, 0xcf9f, 0xcf30, 0x5e89, 0x405f},
+    {0xc22d, 0x6ee3, 0x6ee2, 0xeee3, 0xf199, 0x92c3, 0x6ee3, 0xeee3, 0xf199, 0x92c3},
+    {0x46be, 0xc2eb, 0x46bd, 0x46be, 0xca2e, 0xc34e, 0x46bd, 0x46bf, 0xca2e, 0xc34f},
+    {0xca2d, 0x338d, 0xca2c, 0xca2d, 0xbe3e, 0xd61d, 0xca2d, 0xca2d, 0xbe3f, 0xd61d},
+    {0xc669, 0xc6cd, 0xc720, 0x4631, 0x4dba, 0x3f11, 0xc721, 0x4631, 0x4dbb, 0x3f11},
+    {0x94a8, 0x86b7, 0x94a8, 0x94a7, 0x0000, 0x4d6b, 0x94a8, 0x94a8, 0x0000, 0x4d6b},
+    {0x7999, 0xfb77, 0xfb63, 0x7b85, 0xff80, 0xbd9e, 0xfb64, 0x7b85, 0xff80, 0xbd9f},
+    {0x9689, 0x9959, 0x995d, 0x1954, 0x0000, 0x3ca1, 0x995d, 0x1955, 0x0000, 0x3ca2},
+    {0x8aed, 0x8b14, 0x8b85, 0x09ec, 0x0000, 0x3f4c, 0x8b85, 0x09ec, 0x0000, 0x3f4d},
+    {0xee5f, 0xca96, 0xee5f, 0xee5e, 0x7982, 0x633e, 0xee5f, 0xee5f, 0x7983, 0x633e},
+    {0xbbd1, 0xb8fd, 0xbbd4, 0xbbcd, 0x354e, 0x4253, 0xbbd5, 0xbbcd, 0x354f, 0x4253},
+    {0xe3cf, 0xabbe, 0xe3cf, 0xe3ce, 0x5019, 0x778b, 0xe3cf, 0xe3cf, 0x501a, 0x778b},
+    {0x3dac, 0xbca0, 0x3d84, 0x3dd4, 0xbad7, 0xc089, 0x3d84, 0x3dd4, 0xbad7, 0xc08a},
+    {0xe841, 0x9342, 0xe841, 0xe840, 0x3c12, 0x7f80, 0xe841, 0xe841, 0x3c12, 0x7f80},
+    {0x43e4, 0x421f, 0x43f7, 0x43d0, 0x468d, 0x4137, 0x43f8, 0x43d0, 0x468e, 0x4138},
+    {0x5e90, 0x3db2, 0x5e90, 0x5e8f, 0x5cc8, 0x604f, 0x5e90, 0x5e90, 0x5cc8, 0x604f},
+    {0xd1a0, 0xd3ec, 0xd3f6, 0x53e2, 0x6613, 0x3d2d, 0xd3f6, 0x53e2, 0x6614, 0x3d2e},
+    {0x3f2c, 0x9d6c, 0x3f2b, 0x3f2c, 0x9d1e, 0xe13a, 0x3f2c, 0x3f2c, 0x9d1f, 0xe13b},
+    {0xff68, 0x7bbf, 0xff66, 0xff69, 0xff80, 0xc31b, 0xff67, 0xff69, 0xff80, 0xc31b},
+    {0x0434, 0x0ae0, 0x0ae0, 0x8adf, 0x0000, 0x38cd, 0x0ae0, 0x8ae0, 0x0000, 0x38ce},
+    {0xa1e7, 0x1eb6, 0xa1e4, 0xa1e9, 0x8124, 0xc2a2, 0xa1e4, 0xa1ea, 0x8124, 0xc2a2},
+    {0x95e9, 0xaab6, 0xaab6, 0x2ab5, 0x0125, 0x2aa3, 0xaab6, 0x2ab6, 0x0126, 0x2aa4},
+    {0xb46c, 0x33fa, 0xb3de, 0xb4b4, 0xa8e6, 0xbff1, 0xb3de, 0xb4b4, 0xa8e6, 0xbff2},
+    {0x71c9, 0xdc80, 0x71c8, 0x71c9, 0xff80, 0xd4c9, 0x71c9, 0x71c9, 0xff80, 0xd4c9},
+    {0x2a35, 0xaa9e, 0xaa07, 0x2af8, 0x955f, 0xbf12, 0xaa07, 0x2af8, 0x955f, 0xbf13},
+    {0xe388, 0x1bb4, 0xe387, 0xe388, 0xbfbf, 0xff80, 0xe388, 0xe388, 0xbfbf, 0xff80},
+    {0xad2a, 0x2971, 0xad29, 0xad2a, 0x9720, 0xc334, 0xad29, 0xad2b, 0x9720, 0xc335},
+    {0x1822, 0xa0f7, 0xa0f6, 0x20f7, 0x8000, 0xb6a7, 0xa0f7, 0x20f7, 0x8000, 0xb6a8},
+    {0x42bb, 0x459c, 0x459e, 0xc599, 0x48e3, 0x3c99, 0x459f, 0xc599, 0x48e4, 0x3c99},
+    {0xac55, 0xd829, 0xd829, 0x5828, 0x450c, 0x13a1, 0xd829, 0x5829, 0x450d, 0x13a1},
+    {0x2a04, 0x274c, 0x2a07, 0x2a00, 0x11d2, 0x4225, 0x2a07, 0x2a01, 0x11d2, 0x4226},
+    {0xa748, 0x5619, 0x5618, 0xd619, 0xbdef, 0x90a7, 0x5619, 0xd619, 0xbdef, 0x90a7},
+    {0x5030, 0x4d62, 0x5033, 0x502c, 0x5e1b, 0x4247, 0x5034, 0x502c, 0x5e1b, 0x4247},
+    {0xc6c6, 0xcb29, 0xcb29, 0x4b28, 0x5282, 0x3b15, 0xcb29, 0x4b29, 0x5283, 0x3b16},
+    {0x98fe, 0x9bde, 0x9be1, 0x1bda, 0x0000, 0x3c92, 0x9be2, 0x1bda, 0x0000, 0x3c92},
+    {0x92ec, 0xbaeb, 0xbaeb, 0x3aea, 0x0e58, 0x1780, 0xbaeb, 0x3aeb, 0x0e59, 0x1781},
+    {0xa057, 0xa378, 0xa37b, 0x2374, 0x0450, 0x3c5d, 0xa37b, 0x2375, 0x0450, 0x3c5e},
+    {0x25df, 0xf14f, 0xf14e, 0x714f, 0xd7b4, 0x8000, 0xf14f, 0x714f, 0xd7b4, 0x8000},
+    {0x2b85, 0xad6d, 0xad5c, 0x2d7d, 0x9976, 0xbd8f, 0xad5c, 0x2d7e, 0x9976, 0xbd90},
+    {0x0683, 0x8c3a, 0x8c39, 0x0c3a, 0x8000, 0xb9b4, 0x8c3a, 0x0c3a, 0x8000, 0xb9b4},
+    {0x1e36, 0x1a2a, 0x1e36, 0x1e35, 0x0000, 0x4389, 0x1e37, 0x1e35, 0x0000, 0x4389},
+    {0x0aeb, 0xbbd9, 0xbbd8, 0x3bd9, 0x8747, 0x8e8a, 0xbbd9, 0x3bd9, 0x8747, 0x8e8b},
+    {0xd289, 0xcf00, 0xd28a, 0xd288, 0x6209, 0x4309, 0xd28a, 0xd288, 0x6209, 0x4309},
+    {0x4458, 0xf5e7, 0xf5e6, 0x75e7, 0xfac2, 0x8def, 0xf5e7, 0x75e7, 0xfac3, 0x8def},
+    {0x172e, 0x9a65, 0x9a62, 0x1a67, 0x8000, 0xbc42, 0x9a62, 0x1a68, 0x8000, 0xbc43},
+    {0xa8fd, 0x1dbe, 0xa8fc, 0xa8fd, 0x873b, 0xcaaa, 0xa8fd, 0xa8fd, 0x873c, 0xcaaa},
+    {0xf90d, 0xfa8c, 0xfa9d, 0x7a74, 0x7f80, 0x3e00, 0xfa9e, 0x7a75, 0x7f80, 0x3e01},
+    {0xeea1, 0x34d2, 0xeea0, 0xeea1, 0xe404, 0xf944, 0xeea1, 0xeea1, 0xe404, 0xf944},
+    {0xbe62, 0x3e59, 0xbc10, 0xbedd, 0xbd3f, 0xbf85, 0xbc10, 0xbede, 0xbd40, 0xbf85},
+    {0x73f8, 0x253d, 0x73f8, 0x73f7, 0x59b7, 0x7f80, 0x73f8, 0x73f8, 0x59b7, 0x7f80},
+    {0xfd79, 0xff04, 0xff13, 0x7ee8, 0x7f80, 0x3df1, 0xff14, 0x7ee9, 0x7f80, 0x3df1},
+    {0x4f8d, 0x3943, 0x4f8d, 0x4f8c, 0x4956, 0x55b9, 0x4f8d, 0x4f8d, 0x4957, 0x55b9},
+    {0x3d54, 0x3b6a, 0x3d62, 0x3d45, 0x3941, 0x4167, 0x3d63, 0x3d45, 0x3942, 0x4168},
+    {0x1ae8, 0xee05, 0xee04, 0x6e05, 0xc971, 0x8000, 0xee05, 0x6e05, 0xc971, 0x8000},
+    {0xb4c4, 0xb45f, 0xb519, 0xb429, 0x29aa, 0x3fe1, 0xb51a, 0xb429, 0x29ab, 0x3fe1},
+    {0x9cb3, 0xb820, 0xb820, 0x381f, 0x155f, 0x240f, 0xb820, 0x3820, 0x1560, 0x240f},
+    {0x8468, 0x87e3, 0x87e4, 0x07e1, 0x0000, 0x3c02, 0x87e5, 0x07e1, 0x0000, 0x3c03},
+    {0x0f32, 0x837f, 0x0f31, 0x0f32, 0x8000, 0xcb32, 0x0f32, 0x0f32, 0x8000, 0xcb33},
+    {0xb1be, 0x34b6, 0x34b3, 0xb4b8, 0xa707, 0xbc85, 0x34b3, 0xb4b9, 0xa707, 0xbc86},
+    {0xc415, 0xfcc4, 0xfcc4, 0x7cc3, 0x7f80, 0x06c2, 0xfcc4, 0x7cc4, 0x7f80, 0x06c3},
+    {0x90f6, 0x940c, 0x940d, 0x140a, 0x0000, 0x3c60, 0x940e, 0x140a, 0x0000, 0x3c61},
+    {0xa115, 0xa55e, 0xa55e, 0x255d, 0x0701, 0x3b2b, 0xa55f, 0x255d, 0x0701, 0x3b2c},
+    {0x0ccb, 0x0dfb, 0x0e16, 0x8dc8, 0x0000, 0x3e4f, 0x0e17, 0x8dc8, 0x0000, 0x3e4f},
+    {0xf98f, 0x45c5, 0xf98e, 0xf98f, 0xff80, 0xf339, 0xf98f, 0xf98f, 0xff80, 0xf33a},
+    {0xfa55, 0xfc78, 0xfc82, 0x7c6a, 0x7f80, 0x3d5b, 0xfc83, 0x7c6b, 0x7f80, 0x3d5c},
+    {0xdd31, 0xd5dc, 0xdd31, 0xdd30, 0x7398, 0x46cd, 0xdd31, 0xdd31, 0x7398, 0x46ce},
+    {0x9b8c, 0x99a1, 0x9b96, 0x9b81, 0x0000, 0x415e, 0x9b96, 0x9b82, 0x0000, 0x415f},
+    {0x862a, 0xa901, 0xa901, 0x2900, 0x0000, 0x1ca8, 0xa901, 0x2901, 0x0000, 0x1ca9},
+    {0xd3c8, 0xd6d5, 0xd6d8, 0x56d1, 0x6b26, 0x3c70, 0xd6d8, 0x56d2, 0x6b26, 0x3c70},
+    {0xe81c, 0x1c97, 0xe81b, 0xe81c, 0xc538, 0xff80, 0xe81c, 0xe81c, 0xc538, 0xff80},
+    {0x0216, 0x8417, 0x840d, 0x0420, 0x8000, 0xbd7e, 0x840e, 0x0420, 0x8000, 0xbd7e},
+    {0x2b08, 0x0144, 0x2b08, 0x2b07, 0x0000, 0x6931, 0x2b08, 0x2b08, 0x0000, 0x6932},
+    {0x4a5a, 0x4b88, 0x4ba3, 0xcb59, 0x5667, 0x3e4d, 0x4ba3, 0xcb5a, 0x5668, 0x3e4d},
+    {0x1e77, 0x39a8, 0x39a8, 0xb9a7, 0x18a2, 0x243c, 0x39a8, 0xb9a8, 0x18a2, 0x243c},
+    {0x8bc4, 0x0a3a, 0x8bac, 0x8bdb, 0x8000, 0xc106, 0x8bad, 0x8bdb, 0x8000, 0xc107},
+    {0x932d, 0x7e29, 0x7e28, 0xfe29, 0xd1e4, 0x8000, 0x7e29, 0xfe29, 0xd1e4, 0x8000},
+    {0xb46b, 0xb54e, 0xb584, 0x3513, 0x2a3d, 0x3e92, 0xb584, 0x3513, 0x2a3d, 0x3e92},
+    {0xf49e, 0x828a, 0xf49e, 0xf49d, 0x37aa, 0x7f80, 0xf49e, 0xf49e, 0x37aa, 0x7f80},
+    {0x08d2, 0x07b2, 0x08fe, 0x08a5, 0x0000, 0x4097, 0x08fe, 0x08a6, 0x0000, 0x4097},
+    {0x35a6, 0x54c3, 0x54c3, 0xd4c2, 0x4afc, 0x2059, 0x54c3, 0xd4c3, 0x4afd, 0x205a},
+    {0x7f3d, 0x7f0a, 0x7f80, 0x7e4c, 0x7f80, 0x3faf, 0x7f80, 0x7e4c, 0x7f80, 0x3faf},
+    {0x361f, 0x7929, 0x7929, 0xf928, 0x6fd1, 0x0000, 0x7929, 0xf929, 0x6fd2, 0x0000},
+    {0xc4aa, 0xc5b5, 0xc5df, 0x458a, 0x4af0, 0x3e70, 0xc5e0, 0x458a, 0x4af0, 0x3e70},
+    {0x8bad, 0x5437, 0x5436, 0xd437, 0xa077, 0x8000, 0x5437, 0xd437, 0xa077, 0x8000},
+    {0x588c, 0x558d, 0x588e, 0x5889, 0x6e9a, 0x427e, 0x588e, 0x588a, 0x6e9a, 0x427e},
+    {0x01b8, 0x844f, 0x8449, 0x0454, 0x8000, 0xbce3, 0x8449, 0x0455, 0x8000, 0xbce4},
+    {0x4304, 0xc4fe, 0xc4ed, 0x4507, 0xc882, 0xbd85, 0xc4ee, 0x4507, 0xc883, 0xbd85},
+    {0xfd57, 0xc788, 0xfd57, 0xfd56, 0x7f80, 0x754a, 0xfd57, 0xfd57, 0x7f80, 0x754a},
+    {0x5986, 0xd9ec, 0xd94c, 0x5a39, 0xf3f7, 0xbf11, 0xd94c, 0x5a39, 0xf3f7, 0xbf11},
+    {0x41df, 0xa7df, 0x41de, 0x41df, 0xaa42, 0xd980, 0x41df, 0x41df, 0xaa42, 0xd980},
+    {0x438d, 0xc774, 0xc772, 0x4775, 0xcb86, 0xbb93, 0xc773, 0x4775, 0xcb86, 0xbb94},
+};
+
+#endif /* BF16_VECTORS_H */
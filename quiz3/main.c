@@ -1,61 +1,255 @@
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
+
 #include "q3_c.h"
-static const uint32_t rsqrt_table[32] = {
-    65536, 46341, 32768, 23170, 16384,  /* 2^0 to 2^4 */
-    11585,  8192,  5793,  4096,  2896,  /* 2^5 to 2^9 */
-     2048,  1448,  1024,   724,   512,  /* 2^10 to 2^14 */
-      362,   256,   181,   128,    90,  /* 2^15 to 2^19 */
-       64,    45,    32,    23,    16,  /* 2^20 to 2^24 */
-       11,     8,     6,     4,     3,  /* 2^25 to 2^29 */
-        2,     1                         /* 2^30, 2^31 */
-};
-static uint64_t mul32(uint32_t a, uint32_t b)
-{
-    uint64_t r = 0;
-    for(int i = 0; i < 32; i++)
-    {
-        if(b & 1u << i) // current b's last bit is odd
-            r += (uint64_t)a << i;
-    }
-    return r;
-}
-static int clz(uint32_t x)
-{
-    if(!x) return 32;
-    int n = 0; //result
-    // by binary search
-    if(!(x & 0XFFFF0000)) { n += 16; x <<= 16;} // top 16 bits are all zero
-    if(!(x & 0XFF000000)) { n += 8; x <<= 8;} // top 24 bits are all zero
-    if(!(x & 0XF0000000)) { n += 4; x <<= 4;} // top 28 bits are all zero
-    if(!(x & 0XC0000000)) { n += 2; x <<= 2;} // top 30 bits are all zero
-    if(!(x & 0X80000000)) { n += 1;} // finish check all 31 bits;
-    return n;
-}
-uint32_t fast_rsqrt(uint32_t x)
-{
-    /* y's format is Q16.16 */
-    if(x == 0) return 0xFFFFFFFF; // represents inf
-    if(x == 1) return 65536;
-    /* Find MSB position */
-    int exp = 31 - clz(x);
-    /* get initial guess by LUT */
-    uint32_t y = rsqrt_table[exp]; // lookup table by exp
-    /* linear interpolation */
-    if(x > (1u << exp))
-    {
-        uint32_t y_next = (exp < 31) ? rsqrt_table[exp + 1] : 0;
-        uint32_t delta = y - y_next; 
-        uint32_t frac = (uint32_t)((((uint64_t)x - (1UL << exp)) << 16) >> exp); // let frac be Q16.16
-
-        y -= (uint32_t)((delta * frac) >> 16); // scale down to  Q16.16
-        // y -= (uint32_t)(mul32(delta, frac) >> 16); // scale down to  Q16.16
-    }
-    /* Newton-Raphson Iteration */
-    for(int i = 0; i < 2; i++)
-    {
-        uint32_t y2 = (uint32_t)mul32(y, y); 
-        uint32_t xy2 = (uint32_t)(mul32(x, y2) >> 16);// scale down back to Q16.16
-        y = (uint32_t)(mul32(y, (3u << 16) - xy2) >> 17); // scale down back to Q16.16 and divided by 2, so it is (>> 17 = 16 +1)
-    }
-    return y;
+
+#define printstr(ptr, length)                   \
+    do {                                        \
+        asm volatile(                           \
+            "add a7, x0, 0x40;"                 \
+            "add a0, x0, 0x1;" /* stdout */     \
+            "add a1, x0, %0;"                   \
+            "mv a2, %1;" /* length character */ \
+            "ecall;"                            \
+            :                                   \
+            : "r"(ptr), "r"(length)             \
+            : "a0", "a1", "a2", "a7");          \
+    } while (0)
+
+#define TEST_OUTPUT(msg, length) printstr(msg, length)
+
+#define TEST_LOGGER(msg)                     \
+    {                                        \
+        char _msg[] = msg;                   \
+        TEST_OUTPUT(_msg, sizeof(_msg) - 1); \
+    }
+
+extern uint64_t get_cycles(void);
+extern uint64_t get_instret(void);
+
+/* mathrt.S: umul64 behind mul32 in q3_c.c, native mul/mulhu under
+ * make M_EXT=1 */
+/* quotient in the low word, remainder in the high word */
+extern uint64_t udivmod(uint32_t n, uint32_t d);
+extern uint64_t udivmod10(uint32_t n);
+extern const uint32_t mathrt_m;
+
+/* Write val in decimal so that it ends right before end, return its start */
+static char *fmt_dec(char *end, unsigned long val)
+{
+    do {
+        uint64_t qr = udivmod10(val);
+        *--end = '0' + (uint32_t) (qr >> 32);
+        val = (uint32_t) qr;
+    } while (val > 0);
+    return end;
+}
+
+/* Same for a 64-bit val: while it has a high word, divide by 10 as
+ * three 32-bit steps, hi / 10 and then the remainder with each half of
+ * lo, every one of which udivmod10 does without a loop */
+static char *fmt_dec64(char *end, uint64_t val)
+{
+    while (val >> 32) {
+        uint32_t lo = (uint32_t) val;
+        uint64_t qh = udivmod10((uint32_t) (val >> 32));
+        uint64_t q1 = udivmod10((uint32_t) (qh >> 32) << 16 | lo >> 16);
+        uint64_t q0 = udivmod10((uint32_t) (q1 >> 32) << 16 | (lo & 0xFFFF));
+        *--end = '0' + (uint32_t) (q0 >> 32);
+        val = (uint64_t) (uint32_t) qh << 32 | (uint32_t) q1 << 16 |
+              (uint32_t) q0;
+    }
+    return fmt_dec(end, (uint32_t) val);
+}
+
+/* num / den and num % den for 64-bit operands below 2^63: udivmod
+ * when both fit in 32 bits, otherwise one shift-subtract step per
+ * quotient bit. Only used for formatting, outside timed regions. */
+static uint64_t udivmod64(uint64_t num, uint64_t den, uint64_t *rem)
+{
+    if (!(num >> 32) && !(den >> 32)) {
+        uint64_t qr = udivmod((uint32_t) num, (uint32_t) den);
+        *rem = qr >> 32;
+        return (uint32_t) qr;
+    }
+
+    uint64_t q = 0, r = 0;
+    for (int i = 0; i < 64; i++) {
+        r = r << 1 | num >> 63;
+        num <<= 1;
+        q <<= 1;
+        if (r >= den) {
+            r -= den;
+            q |= 1;
+        }
+    }
+    *rem = r;
+    return q;
+}
+
+/* Same for num / den with two decimals */
+static char *fmt_ratio(char *end, uint64_t num, uint64_t den)
+{
+    /* 0.00 for an empty region rather than the all-ones quotient */
+    if (!den) {
+        num = 0;
+        den = 1;
+    }
+
+    /* Whole part and remainder first; the remainder is below den, so
+     * scaling it by 100 stays exact in 64 bits for any den below 2^57 */
+    uint64_t rem, whole = udivmod64(num, den, &rem);
+    uint64_t d = udivmod10((uint32_t) udivmod64(rem * 100, den, &rem));
+
+    *--end = '0' + (uint32_t) (d >> 32);
+    *--end = '0' + (uint32_t) d;
+    *--end = '.';
+    return fmt_dec64(end, whole);
+}
+
+static void print_dec64(uint64_t val)
+{
+    char buf[24];
+    char *end = buf + sizeof(buf) - 1;
+    *end = '\n';
+
+    char *p = fmt_dec64(end, val);
+    TEST_OUTPUT(p, (buf + sizeof(buf) - p));
+}
+
+/* Print cycles per byte with two decimals */
+static void print_cpb(uint64_t cycles, uint64_t bytes)
+{
+    char buf[24];
+    char *end = buf + sizeof(buf) - 1;
+    *end = '\n';
+
+    char *p = fmt_ratio(end, cycles, bytes);
+    TEST_OUTPUT(p, (buf + sizeof(buf) - p));
+}
+
+/* ============= Performance Counters ============= */
+
+typedef struct {
+    uint64_t cycles, instret;
+} counters_t;
+
+/* What an empty region costs, set by counters_calibrate() */
+static counters_t counter_overhead;
+
+static void counters_read(counters_t *c)
+{
+    c->cycles = get_cycles();
+    c->instret = get_instret();
+}
+
+/* Counters elapsed since start less the measurement overhead; 64-bit
+ * throughout, so long regions do not wrap */
+static counters_t counters_since(const counters_t *start)
+{
+    counters_t now, d;
+
+    counters_read(&now);
+    d.cycles = now.cycles - start->cycles;
+    d.instret = now.instret - start->instret;
+    d.cycles = d.cycles > counter_overhead.cycles
+                   ? d.cycles - counter_overhead.cycles
+                   : 0;
+    d.instret = d.instret > counter_overhead.instret
+                    ? d.instret - counter_overhead.instret
+                    : 0;
+    return d;
+}
+
+/* Time an empty region a few times and keep the cheapest */
+static void counters_calibrate(void)
+{
+    counters_t start, empty, best = {~0ULL, ~0ULL};
+
+    counter_overhead = (counters_t) {0, 0};
+    for (int i = 0; i < 8; i++) {
+        counters_read(&start);
+        empty = counters_since(&start);
+        if (empty.cycles < best.cycles)
+            best.cycles = empty.cycles;
+        if (empty.instret < best.instret)
+            best.instret = empty.instret;
+    }
+    counter_overhead = best;
+}
+
+/* ============= fast_rsqrt ============= */
+
+#define RSQRT_BENCH_N 1024
+
+static uint32_t rsqrt_bench_x[RSQRT_BENCH_N];
+static uint32_t rsqrt_bench_y[RSQRT_BENCH_N];
+
+/* xorshift32, no multiply needed */
+static uint32_t bench_rand(uint32_t *state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+/* Powers of 4 come out exact: the table holds 2^16 >> k for 4^k and
+ * the Newton steps leave that value unchanged */
+static bool test_fast_rsqrt(void)
+{
+    bool passed = fast_rsqrt(0) == 0xFFFFFFFF;
+
+    for (uint32_t k = 0; k < 16; k++) {
+        if (fast_rsqrt(1u << (2 * k)) != 65536u >> k)
+            passed = false;
+    }
+    return passed;
+}
+
+int main(void)
+{
+    uint32_t state = 0x2545F491;
+    counters_t start, elapsed;
+
+    counters_calibrate();
+    TEST_LOGGER("\n=== fast_rsqrt Tests ===\n\n");
+
+    if (mathrt_m) {
+        TEST_LOGGER("  Runtime: M extension mul/mulhu\n");
+    } else {
+        TEST_LOGGER("  Runtime: RV32I software\n");
+    }
+
+    if (test_fast_rsqrt()) {
+        TEST_LOGGER("  Powers of 4: PASSED\n");
+    } else {
+        TEST_LOGGER("  Powers of 4: FAILED\n");
+    }
+
+    /* Random magnitudes, so every table entry and both mul32 operand
+     * widths get exercised */
+    for (size_t i = 0; i < RSQRT_BENCH_N; i++) {
+        uint32_t r = bench_rand(&state);
+        rsqrt_bench_x[i] = bench_rand(&state) >> (r & 31);
+    }
+
+    counters_read(&start);
+    for (size_t i = 0; i < RSQRT_BENCH_N; i++)
+        rsqrt_bench_y[i] = fast_rsqrt(rsqrt_bench_x[i]);
+    elapsed = counters_since(&start);
+
+    TEST_LOGGER("  fast_rsqrt cycles/op: ");
+    print_cpb(elapsed.cycles, RSQRT_BENCH_N);
+    TEST_LOGGER("  Cycles: ");
+    print_dec64(elapsed.cycles);
+    TEST_LOGGER("  Instructions: ");
+    print_dec64(elapsed.instret);
+
+    TEST_LOGGER("\n=== All Tests Completed ===\n");
+
+    return 0;
 }
@@ -9,15 +9,12 @@ static const uint32_t rsqrt_table[32] = {
        11,     8,     6,     4,     3,  /* 2^25 to 2^29 */
         2,     1                         /* 2^30, 2^31 */
 };
+extern uint64_t umul64(uint32_t a, uint32_t b); // mathrt.S
 static uint64_t mul32(uint32_t a, uint32_t b)
 {
-    uint64_t r = 0;
-    for(int i = 0; i < 32; i++)
-    {
-        if(b & 1u << i) // current b's last bit is odd
-            r += (uint64_t)a << i;
-    }
-    return r;
+    // mul/mulhu with M_EXT=1, otherwise a shift-add loop that stops
+    // after the smaller operand's top bit instead of always running 32
+    return umul64(a, b);
 }
 static int clz(uint32_t x)
 {
@@ -0,0 +1,374 @@
+/* Host-side conformance harness for bf16.h, built with the native
+ * compiler:
+ *   make host-test
+ * runs it once per rounding mode (BF16_ROUND_NEAREST=0 and 1). Every one
+ * of the 2^32 operand pairs of add, sub, mul and div is checked against
+ * the hardware double result rounded once to bf16, with the work split
+ * across host threads (BF16_THREADS overrides the count).
+ *   make vectors
+ * writes bf16_vectors.h, the sampled subset main.c runs on rv32emu.
+ */
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "bf16.h"
+
+/* Every bf16 as a double, filled in by main */
+static double bf16_double[0x10000];
+
+static double bf16_to_double_slow(uint16_t bits)
+{
+    int exp = (bits >> 7) & 0xFF;
+    double v;
+
+    if (exp == 0xFF)
+        v = bits & 0x7F ? NAN : INFINITY;
+    else if (exp)
+        v = ldexp(0x80 | (bits & 0x7F), exp - 134);
+    else
+        v = ldexp(bits & 0x7F, -133);
+    return bits & 0x8000 ? -v : v;
+}
+
+static inline double bf16_to_double(uint16_t bits)
+{
+    return bf16_double[bits];
+}
+
+/* bf16 of the exact value v + err, where v is a finite, nonzero double
+ * and |err| is below half an ulp of v: the residual only matters when v
+ * sits on a tie or on a bf16 value itself. Rounds to nearest even or
+ * toward zero; both overflow to infinity. */
+static uint16_t bf16_from_exact(double v, double err, bool rne)
+{
+    uint64_t d;
+    memcpy(&d, &v, sizeof(d));
+    uint16_t sign = d >> 48 & 0x8000;
+    int exp = (int) (d >> 52 & 0x7FF) - 1023 + BF16_EXP_BIAS;
+    uint64_t sig = (d & ((1ULL << 52) - 1)) | 1ULL << 52;
+
+    if (sign)
+        err = -err;
+
+    /* sig bits below the bf16 ulp, which sits at exponent 1 for
+     * subnormals */
+    int shift = 45 + (exp < 1 ? 1 - exp : 0);
+    uint64_t rest = shift < 64 ? sig & ((1ULL << shift) - 1) : sig;
+    uint32_t t = shift < 64 ? sig >> shift : 0;
+
+    /* The hidden bit carries into the exponent field */
+    if (exp > 1)
+        t += (uint32_t) (exp - 1) << 7;
+    if (rne) {
+        uint64_t half = shift < 64 ? 1ULL << (shift - 1) : UINT64_MAX;
+        if (rest > half ||
+            (rest == half && (err > 0 || (err == 0 && (t & 1)))))
+            t++;
+    } else if (!rest && err < 0)
+        t--;
+    return sign | (t >= 0x7F80 ? 0x7F80 : t);
+}
+
+/* v rounded toward zero, overflowing to infinity like the engine */
+static uint16_t bf16_from_double_rz(double v)
+{
+    return v == 0 ? (signbit(v) ? 0x8000 : 0) : bf16_from_exact(v, 0, false);
+}
+
+/* s + err == a + b exactly */
+static double two_sum(double a, double b, double *err)
+{
+    double s = a + b, bb = s - a;
+
+    *err = (a - (s - bb)) + (b - bb);
+    return s;
+}
+
+/* Hardware result rounded once: NaN, infinite and zero results come
+ * straight from the double arithmetic, which gets their signs right */
+static uint16_t bf16_pack_ref(double r, double err, bool rne)
+{
+    if (isnan(r))
+        return 0x7FC0;
+    if (isinf(r) || r == 0)
+        return (signbit(r) ? 0x8000 : 0) | (isinf(r) ? 0x7F80 : 0);
+    return bf16_from_exact(r, err, rne);
+}
+
+static uint16_t ref_add(uint16_t a, uint16_t b, bool rne)
+{
+    double e = 0, s = bf16_to_double(a) + bf16_to_double(b);
+
+    if (isfinite(s))
+        two_sum(bf16_to_double(a), bf16_to_double(b), &e);
+    return bf16_pack_ref(s, e, rne);
+}
+
+static uint16_t ref_sub(uint16_t a, uint16_t b, bool rne)
+{
+    return ref_add(a, b ^ 0x8000, rne);
+}
+
+/* 8 x 8 significand bits, exact in a double */
+static uint16_t ref_mul(uint16_t a, uint16_t b, bool rne)
+{
+    return bf16_pack_ref(bf16_to_double(a) * bf16_to_double(b), 0, rne);
+}
+
+static uint16_t ref_div(uint16_t a, uint16_t b, bool rne)
+{
+    double u = bf16_to_double(a), v = bf16_to_double(b), q = u / v;
+
+    return bf16_pack_ref(q, isfinite(q) && q ? fma(-q, v, u) / v : 0, rne);
+}
+
+typedef struct {
+    const char *name;
+    bf16_t (*fn)(bf16_t, bf16_t);
+    uint16_t (*ref)(uint16_t, uint16_t, bool);
+} bf16_op_t;
+
+static const bf16_op_t bf16_ops[4] = {
+    {"add", bf16_add, ref_add},
+    {"sub", bf16_sub, ref_sub},
+    {"mul", bf16_mul, ref_mul},
+    {"div", bf16_div, ref_div},
+};
+
+/* Any NaN matches a NaN reference; the engines pass NaN operands
+ * through instead of building a canonical one */
+static bool bf16_same(uint16_t r, uint16_t ref)
+{
+    if ((ref & 0x7FFF) > 0x7F80)
+        return (r & 0x7FFF) > 0x7F80;
+    return r == ref;
+}
+
+typedef struct {
+    const bf16_op_t *op;
+    uint32_t first, step;
+    unsigned long long wrong;
+    uint32_t first_wrong; /* a << 16 | b, lowest mismatching pair */
+    double secs;
+} bf16_job_t;
+
+/* Thread body: every a = first + k * step, against every b */
+static void *check_job(void *arg)
+{
+    bf16_job_t *job = arg;
+
+    job->first_wrong = UINT32_MAX;
+    for (uint32_t a = job->first; a < 0x10000; a += job->step) {
+        for (uint32_t b = 0; b < 0x10000; b++) {
+            uint16_t r = job->op->fn((bf16_t) {.bits = a}, (bf16_t) {.bits = b})
+                             .bits;
+            uint16_t ref = job->op->ref(a, b, BF16_ROUND_NEAREST);
+
+            if (!bf16_same(r, ref) && !job->wrong++)
+                job->first_wrong = a << 16 | b;
+        }
+    }
+    return NULL;
+}
+
+/* Thread body: engine only, for throughput */
+static void *bench_job(void *arg)
+{
+    bf16_job_t *job = arg;
+    volatile uint16_t sink = 0;
+    struct timespec t0, t1;
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (uint32_t a = job->first; a < 0x10000; a += job->step) {
+        for (uint32_t b = 0; b < 0x10000; b++)
+            sink ^= job->op->fn((bf16_t) {.bits = a}, (bf16_t) {.bits = b})
+                        .bits;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    job->secs = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+    return NULL;
+}
+
+static unsigned nthreads(void)
+{
+    const char *env = getenv("BF16_THREADS");
+    long n = env ? atol(env) : sysconf(_SC_NPROCESSORS_ONLN);
+
+    return n < 1 ? 1 : n > 256 ? 256 : n;
+}
+
+static void run_jobs(const bf16_op_t *op, void *(*body)(void *),
+                     bf16_job_t *jobs, unsigned n)
+{
+    pthread_t th[256];
+
+    for (unsigned t = 0; t < n; t++) {
+        jobs[t] = (bf16_job_t) {.op = op, .first = t, .step = n};
+        pthread_create(&th[t], NULL, body, &jobs[t]);
+    }
+    for (unsigned t = 0; t < n; t++)
+        pthread_join(th[t], NULL);
+}
+
+/* All 2^32 pairs of one operation, then its engine-only throughput */
+static int check_op(const bf16_op_t *op)
+{
+    unsigned n = nthreads();
+    bf16_job_t jobs[256];
+    unsigned long long wrong = 0;
+    uint32_t first = UINT32_MAX;
+    double secs = 0;
+
+    run_jobs(op, check_job, jobs, n);
+    for (unsigned t = 0; t < n; t++) {
+        wrong += jobs[t].wrong;
+        if (jobs[t].wrong && jobs[t].first_wrong < first)
+            first = jobs[t].first_wrong;
+    }
+
+    run_jobs(op, bench_job, jobs, n);
+    for (unsigned t = 0; t < n; t++)
+        secs = jobs[t].secs > secs ? jobs[t].secs : secs;
+
+    printf("bf16_%s: 4294967296 checked, %llu wrong, %.1f Mops/s on %u "
+           "threads\n",
+           op->name, wrong, 4294967296.0 / secs / 1e6, n);
+    if (wrong) {
+        uint16_t a = first >> 16, b = first;
+        printf("  first mismatch: bf16_%s(%04x, %04x) = %04x, expected "
+               "%04x\n",
+               op->name, a, b,
+               op->fn((bf16_t) {.bits = a}, (bf16_t) {.bits = b}).bits,
+               op->ref(a, b, BF16_ROUND_NEAREST));
+    }
+    return wrong != 0;
+}
+
+static uint32_t rand_state = 0x9E3779B9;
+
+static uint32_t rand32(void)
+{
+    rand_state ^= rand_state << 13;
+    rand_state ^= rand_state >> 17;
+    rand_state ^= rand_state << 5;
+    return rand_state;
+}
+
+static bool bf16_finite_nonzero(uint32_t bits)
+{
+    return (bits & 0x7FFF) && (bits & 0x7F80) != 0x7F80;
+}
+
+static uint16_t rand_bf16(void)
+{
+    uint16_t bits;
+
+    do
+        bits = rand32();
+    while (!bf16_finite_nonzero(bits));
+    return bits;
+}
+
+/* Random finite, nonzero triples against a * b + c in double, half of
+ * them with c close to -a * b so the sum cancels */
+static int check_fma(void)
+{
+    const unsigned long long n = 100000000;
+    unsigned long long wrong = 0;
+
+    for (unsigned long long i = 0; i < n; i++) {
+        uint16_t a = rand_bf16(), b = rand_bf16(), c = rand_bf16();
+        double p = bf16_to_double(a) * bf16_to_double(b), e, s;
+
+        if (i & 1) {
+            c = (bf16_from_double_rz(-p) + (c & 3) - 1) & 0xFFFF;
+            if (!bf16_finite_nonzero(c))
+                continue;
+        }
+        s = two_sum(p, bf16_to_double(c), &e);
+        uint16_t ref = s == 0 ? 0 : bf16_from_exact(s, e, BF16_ROUND_NEAREST);
+        uint16_t r =
+            bf16_fma((bf16_t) {.bits = a}, (bf16_t) {.bits = b},
+                     (bf16_t) {.bits = c})
+                .bits;
+        if (r != ref && !wrong++)
+            printf("  first mismatch: bf16_fma(%04x, %04x, %04x) = %04x, "
+                   "expected %04x\n",
+                   a, b, c, r, ref);
+    }
+    printf("bf16_fma: %llu checked, %llu wrong\n", n, wrong);
+    return wrong != 0;
+}
+
+#define BF16_VECTORS 512
+
+/* Sampled pairs for the target: special operands against each other
+ * first, then random patterns, every other one with b within 8 binades
+ * of a so add and sub reach normalization and cancellation */
+static void write_vectors(void)
+{
+    static const uint16_t edge[] = {0x0000, 0x8000, 0x0001, 0x807F,
+                                    0x0080, 0x7F7F, 0xFF7F, 0x7F80,
+                                    0xFF80, 0x7FC0, 0x7F81, 0x3F80};
+    const size_t nedge = sizeof(edge) / sizeof(edge[0]);
+
+    printf("/* Generated by make vectors (bf16_host_test --vectors); do "
+           "not edit.\n"
+           " * Sampled operand pairs {a, b} followed by the reference "
+           "add, sub, mul\n"
+           " * and div results, first truncated, then rounded to nearest "
+           "even. */\n"
+           "#ifndef BF16_VECTORS_H\n#define BF16_VECTORS_H\n\n"
+           "#define BF16_VECTORS %d\n\n"
+           "static const uint16_t bf16_vectors[BF16_VECTORS][10] = {\n",
+           BF16_VECTORS);
+    for (size_t i = 0; i < BF16_VECTORS; i++) {
+        uint16_t a, b;
+
+        if (i < nedge * nedge) {
+            a = edge[i / nedge];
+            b = edge[i % nedge];
+        } else {
+            uint32_t r = rand32();
+            a = r;
+            b = r >> 16;
+            if (i & 1) {
+                int exp = ((a >> 7) & 0xFF) + (int) (rand32() & 15) - 8;
+                exp = exp < 0 ? 0 : exp > 0xFE ? 0xFE : exp;
+                b = (b & 0x807F) | exp << 7;
+            }
+        }
+        printf("    {0x%04x, 0x%04x", a, b);
+        for (int rne = 0; rne < 2; rne++) {
+            for (int k = 0; k < 4; k++)
+                printf(", 0x%04x", bf16_ops[k].ref(a, b, rne));
+        }
+        printf("},\n");
+    }
+    printf("};\n\n#endif /* BF16_VECTORS_H */\n");
+}
+
+int main(int argc, char **argv)
+{
+    int failed = 0;
+
+    /* One line per operation as it finishes, also through a pipe */
+    setvbuf(stdout, NULL, _IOLBF, 0);
+    for (uint32_t i = 0; i < 0x10000; i++)
+        bf16_double[i] = bf16_to_double_slow(i);
+    if (argc > 1 && !strcmp(argv[1], "--vectors")) {
+        write_vectors();
+        return 0;
+    }
+
+    printf("rounding: %s\n", BF16_ROUND_NEAREST ? "nearest even" : "truncate");
+    for (int k = 0; k < 4; k++)
+        failed |= check_op(&bf16_ops[k]);
+    failed |= check_fma();
+    return failed;
+}
@@ -1,9 +1,24 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
+
+#include "bf16.h"
+#include "bf16_vectors.h"
+#include "uf8_stream.h"
+
 /* ============= uint8_to_uint32 ============= */
+/* Largest value a uf8 code decodes to: mantissa 15, exponent 15 */
+#define UF8_MAX_VALUE 0xF7FF0
+
 extern int uf8_decoder(int x);
 extern int uf8_encoder(int x);
+extern int uf8_encoder_loop(int x);
+extern int uf8_decoder_lut(int x);
+extern int uf8_encoder_lut(int x);
+extern int uf8_encoder_sat(int x);
+extern int uf8_encoder_round(int x);
+extern void uf8_encode_array(const uint32_t *in, uint8_t *out, size_t n);
+extern void uf8_decode_array(const uint8_t *in, uint32_t *out, size_t n);
 #define printstr(ptr, length)                   \
     do {                                        \
         asm volatile(                           \
@@ -17,7 +32,7 @@ extern int uf8_encoder(int x);
             : "a0", "a1", "a2", "a7");          \
     } while (0)
 
-#define TEST_OUTPUT(msg, length) printstr(msg, length)
+#define TEST_OUTPUT(msg, length) console_write(msg, length)
 
 #define TEST_LOGGER(msg)                     \
     {                                        \
@@ -28,6 +43,19 @@ extern int uf8_encoder(int x);
 extern uint64_t get_cycles(void);
 extern uint64_t get_instret(void);
 
+/* mathrt.S: the integer runtime GCC calls for *, / and % on RV32I,
+ * native M-extension instructions under make M_EXT=1 */
+extern uint32_t __mulsi3(uint32_t a, uint32_t b);
+extern uint64_t __muldi3(uint64_t a, uint64_t b);
+extern uint32_t __udivsi3(uint32_t a, uint32_t b);
+extern uint32_t __umodsi3(uint32_t a, uint32_t b);
+extern uint64_t umul64(uint32_t a, uint32_t b);
+extern uint32_t umulh32(uint32_t a, uint32_t b);
+/* quotient in the low word, remainder in the high word */
+extern uint64_t udivmod(uint32_t n, uint32_t d);
+extern uint64_t udivmod10(uint32_t n);
+extern const uint32_t mathrt_m;
+
 /* Bare metal memcpy implementation */
 void *memcpy(void *dest, const void *src, size_t n)
 {
@@ -38,64 +66,47 @@ void *memcpy(void *dest, const void *src, size_t n)
     return dest;
 }
 
-/* Software division for RV32I (no M extension) */
-static unsigned long udiv(unsigned long dividend, unsigned long divisor)
-{
-    if (divisor == 0)
-        return 0;
+/* ============= Console Output ============= */
 
-    unsigned long quotient = 0;
-    unsigned long remainder = 0;
+/* Output collects here and goes out in one write ecall per flush rather
+ * than one per fragment; a full buffer flushes itself */
+#define CONSOLE_BUF_SIZE 1024
 
-    for (int i = 31; i >= 0; i--) {
-        remainder <<= 1;
-        remainder |= (dividend >> i) & 1;
+static char console_buf[CONSOLE_BUF_SIZE];
+static size_t console_len;
 
-        if (remainder >= divisor) {
-            remainder -= divisor;
-            quotient |= (1UL << i);
-        }
+static void console_flush(void)
+{
+    if (console_len) {
+        printstr(console_buf, console_len);
+        console_len = 0;
     }
-
-    return quotient;
 }
 
-static unsigned long umod(unsigned long dividend, unsigned long divisor)
+static void console_write(const char *s, size_t n)
 {
-    if (divisor == 0)
-        return 0;
-
-    unsigned long remainder = 0;
-
-    for (int i = 31; i >= 0; i--) {
-        remainder <<= 1;
-        remainder |= (dividend >> i) & 1;
-
-        if (remainder >= divisor) {
-            remainder -= divisor;
+    if (n > CONSOLE_BUF_SIZE - console_len) {
+        console_flush();
+        if (n > CONSOLE_BUF_SIZE) {
+            printstr(s, n);
+            return;
         }
     }
-
-    return remainder;
+    memcpy(console_buf + console_len, s, n);
+    console_len += n;
 }
 
-/* Software multiplication for RV32I (no M extension) */
-static uint32_t umul(uint32_t a, uint32_t b)
+static void console_putc(char c)
 {
-    uint32_t result = 0;
-    while (b) {
-        if (b & 1)
-            result += a;
-        a <<= 1;
-        b >>= 1;
-    }
-    return result;
+    if (console_len == CONSOLE_BUF_SIZE)
+        console_flush();
+    console_buf[console_len++] = c;
 }
 
-/* Provide __mulsi3 for GCC */
-uint32_t __mulsi3(uint32_t a, uint32_t b)
+static void console_puts(const char *s)
 {
-    return umul(a, b);
+    while (*s)
+        console_putc(*s++);
 }
 
 /* Simple integer to hex string conversion */
@@ -119,329 +130,670 @@ static void print_hex(unsigned long val)
     }
 
     p++;
-    printstr(p, (buf + sizeof(buf) - p));
+    TEST_OUTPUT(p, (buf + sizeof(buf) - p));
+}
+
+/* Write val in decimal so that it ends right before end, return its start */
+static char *fmt_dec(char *end, unsigned long val)
+{
+    do {
+        uint64_t qr = udivmod10(val);
+        *--end = '0' + (uint32_t) (qr >> 32);
+        val = (uint32_t) qr;
+    } while (val > 0);
+    return end;
+}
+
+/* Same for a 64-bit val: while it has a high word, divide by 10 as
+ * three 32-bit steps, hi / 10 and then the remainder with each half of
+ * lo, every one of which udivmod10 does without a loop */
+static char *fmt_dec64(char *end, uint64_t val)
+{
+    while (val >> 32) {
+        uint32_t lo = (uint32_t) val;
+        uint64_t qh = udivmod10((uint32_t) (val >> 32));
+        uint64_t q1 = udivmod10((uint32_t) (qh >> 32) << 16 | lo >> 16);
+        uint64_t q0 = udivmod10((uint32_t) (q1 >> 32) << 16 | (lo & 0xFFFF));
+        *--end = '0' + (uint32_t) (q0 >> 32);
+        val = (uint64_t) (uint32_t) qh << 32 | (uint32_t) q1 << 16 |
+              (uint32_t) q0;
+    }
+    return fmt_dec(end, (uint32_t) val);
+}
+
+/* num / den and num % den for 64-bit operands below 2^63: udivmod
+ * when both fit in 32 bits, otherwise one shift-subtract step per
+ * quotient bit. Only used for formatting, outside timed regions. */
+static uint64_t udivmod64(uint64_t num, uint64_t den, uint64_t *rem)
+{
+    if (!(num >> 32) && !(den >> 32)) {
+        uint64_t qr = udivmod((uint32_t) num, (uint32_t) den);
+        *rem = qr >> 32;
+        return (uint32_t) qr;
+    }
+
+    uint64_t q = 0, r = 0;
+    for (int i = 0; i < 64; i++) {
+        r = r << 1 | num >> 63;
+        num <<= 1;
+        q <<= 1;
+        if (r >= den) {
+            r -= den;
+            q |= 1;
+        }
+    }
+    *rem = r;
+    return q;
+}
+
+/* Same for num / den with two decimals */
+static char *fmt_ratio(char *end, uint64_t num, uint64_t den)
+{
+    /* 0.00 for an empty region rather than the all-ones quotient */
+    if (!den) {
+        num = 0;
+        den = 1;
+    }
+
+    /* Whole part and remainder first; the remainder is below den, so
+     * scaling it by 100 stays exact in 64 bits for any den below 2^57 */
+    uint64_t rem, whole = udivmod64(num, den, &rem);
+    uint64_t d = udivmod10((uint32_t) udivmod64(rem * 100, den, &rem));
+
+    *--end = '0' + (uint32_t) (d >> 32);
+    *--end = '0' + (uint32_t) d;
+    *--end = '.';
+    return fmt_dec64(end, whole);
 }
 
 /* Simple integer to decimal string conversion */
 static void print_dec(unsigned long val)
 {
     char buf[20];
-    char *p = buf + sizeof(buf) - 1;
-    *p = '\n';
-    p--;
+    char *end = buf + sizeof(buf) - 1;
+    *end = '\n';
 
-    if (val == 0) {
-        *p = '0';
-        p--;
-    } else {
-        while (val > 0) {
-            *p = '0' + umod(val, 10);
-            p--;
-            val = udiv(val, 10);
-        }
-    }
+    char *p = fmt_dec(end, val);
+    TEST_OUTPUT(p, (buf + sizeof(buf) - p));
+}
 
-    p++;
-    printstr(p, (buf + sizeof(buf) - p));
+static void print_dec64(uint64_t val)
+{
+    char buf[24];
+    char *end = buf + sizeof(buf) - 1;
+    *end = '\n';
+
+    char *p = fmt_dec64(end, val);
+    TEST_OUTPUT(p, (buf + sizeof(buf) - p));
 }
 
-/* ============= BFloat16 Implementation ============= */
+/* Print cycles per byte with two decimals */
+static void print_cpb(uint64_t cycles, uint64_t bytes)
+{
+    char buf[24];
+    char *end = buf + sizeof(buf) - 1;
+    *end = '\n';
 
-typedef struct {
-    uint16_t bits;
-} bf16_t;
+    char *p = fmt_ratio(end, cycles, bytes);
+    TEST_OUTPUT(p, (buf + sizeof(buf) - p));
+}
 
-#define BF16_EXP_BIAS 127
-#define BF16_SIGN_MASK 0x8000U
-#define BF16_EXP_MASK 0x7F80U
-#define BF16_MANT_MASK 0x007FU
+/* ============= Performance Counters ============= */
 
-#define BF16_NAN() ((bf16_t) {.bits = 0x7FC0})
-#define BF16_ZERO() ((bf16_t) {.bits = 0x0000})
+typedef struct {
+    uint64_t cycles, instret;
+} counters_t;
 
-static const bf16_t bf16_one = {.bits = 0x3F80};
-static const bf16_t bf16_two = {.bits = 0x4000};
+/* What an empty region costs, set by counters_calibrate() */
+static counters_t counter_overhead;
 
-static inline bool bf16_isnan(bf16_t a)
+static void counters_read(counters_t *c)
 {
-    return ((a.bits & BF16_EXP_MASK) == BF16_EXP_MASK) &&
-           (a.bits & BF16_MANT_MASK);
+    c->cycles = get_cycles();
+    c->instret = get_instret();
 }
 
-static inline bool bf16_isinf(bf16_t a)
+/* Counters elapsed since start less the measurement overhead; 64-bit
+ * throughout, so long regions do not wrap */
+static counters_t counters_since(const counters_t *start)
 {
-    return ((a.bits & BF16_EXP_MASK) == BF16_EXP_MASK) &&
-           !(a.bits & BF16_MANT_MASK);
+    counters_t now, d;
+
+    counters_read(&now);
+    d.cycles = now.cycles - start->cycles;
+    d.instret = now.instret - start->instret;
+    d.cycles = d.cycles > counter_overhead.cycles
+                   ? d.cycles - counter_overhead.cycles
+                   : 0;
+    d.instret = d.instret > counter_overhead.instret
+                    ? d.instret - counter_overhead.instret
+                    : 0;
+    return d;
 }
 
-static inline bool bf16_iszero(bf16_t a)
+/* Time an empty region a few times and keep the cheapest */
+static void counters_calibrate(void)
 {
-    return !(a.bits & 0x7FFF);
+    counters_t start, empty, best = {~0ULL, ~0ULL};
+
+    counter_overhead = (counters_t) {0, 0};
+    for (int i = 0; i < 8; i++) {
+        counters_read(&start);
+        empty = counters_since(&start);
+        if (empty.cycles < best.cycles)
+            best.cycles = empty.cycles;
+        if (empty.instret < best.instret)
+            best.instret = empty.instret;
+    }
+    counter_overhead = best;
 }
 
-static inline unsigned clz(uint32_t x)
+/* ============= ChaCha20 Declaration ============= */
+
+extern void chacha20(uint8_t *out,
+                     const uint8_t *in,
+                     size_t inlen,
+                     const uint8_t *key,
+                     const uint8_t *nonce,
+                     uint32_t ctr);
+
+/* Same contract as chacha20, tuned for multi-block buffers */
+extern void chacha20_bulk(uint8_t *out,
+                          const uint8_t *in,
+                          size_t inlen,
+                          const uint8_t *key,
+                          const uint8_t *nonce,
+                          uint32_t ctr);
+
+/* One keystream block for (key, nonce, ctr), no input */
+extern void chacha20_block(uint32_t ks[16],
+                           const uint8_t *key,
+                           const uint8_t *nonce,
+                           uint32_t ctr);
+
+typedef void (*chacha20_fn)(uint8_t *out,
+                            const uint8_t *in,
+                            size_t inlen,
+                            const uint8_t *key,
+                            const uint8_t *nonce,
+                            uint32_t ctr);
+
+/* Set when chacha20_asm.S was assembled with Zbb rotates */
+extern const uint32_t chacha20_zbb;
+
+/* ============= ChaCha20 Streaming Context ============= */
+
+typedef struct {
+    uint32_t key[8];
+    uint32_t nonce[3];
+    uint32_t ctr;          /* counter of the next block to generate */
+    uint32_t keystream[16];
+    size_t left;           /* unused bytes at the end of keystream */
+} chacha20_ctx_t;
+
+static void chacha20_ctx_init(chacha20_ctx_t *ctx,
+                              const uint8_t *key,
+                              const uint8_t *nonce,
+                              uint32_t ctr)
 {
-    int n = 32, c = 16;
-    do {
-        uint32_t y = x >> c;
-        if (y) {
-            n -= c;
-            x = y;
-        }
-        c >>= 1;
-    } while (c);
-    return n - x;
+    memcpy(ctx->key, key, sizeof(ctx->key));
+    memcpy(ctx->nonce, nonce, sizeof(ctx->nonce));
+    ctx->ctr = ctr;
+    ctx->left = 0;
 }
 
-static inline bf16_t bf16_add(bf16_t a, bf16_t b)
+/* Chunked callers get the same output as one chacha20 call over the
+ * concatenated input, and no block is generated twice. */
+static void chacha20_ctx_update(chacha20_ctx_t *ctx,
+                                uint8_t *out,
+                                const uint8_t *in,
+                                size_t inlen)
 {
-    uint16_t sign_a = a.bits >> 15 & 0x1, sign_b = b.bits >> 15 & 1;
-    int16_t exp_a = a.bits >> 7 & 0xFF, exp_b = b.bits >> 7 & 0xFF;
-    uint16_t mant_a = a.bits & 0x7F, mant_b = b.bits & 0x7F;
+    const uint8_t *ks = (const uint8_t *) ctx->keystream;
 
-    /* Infinity and NaN */
-    if (exp_a == 0xFF) {
-        if (mant_a)
-            return a;
-        if (exp_b == 0xFF)
-            return (mant_b || sign_a == sign_b) ? b : BF16_NAN();
-        return a;
+    /* Spend keystream left over from the previous call */
+    while (ctx->left && inlen) {
+        *out++ = *in++ ^ ks[64 - ctx->left];
+        ctx->left--;
+        inlen--;
     }
 
-    /* if a is normal/denormal, but b is infinity/NaN */
-    if (exp_b == 0xFF)
-        return b;
+    /* Whole blocks go straight through the kernel */
+    size_t full = inlen & ~(size_t) 63;
+    if (full) {
+        chacha20(out, in, full, (const uint8_t *) ctx->key,
+                 (const uint8_t *) ctx->nonce, ctx->ctr);
+        ctx->ctr += full >> 6;
+        out += full;
+        in += full;
+        inlen -= full;
+    }
 
-    /* if a == 0, b == 0 */
-    if (!exp_a && !mant_a)
-        return b;
-    if (!exp_b && !mant_b)
-        return a;
+    /* Keep the rest of the last block for the next call */
+    if (inlen) {
+        chacha20_block(ctx->keystream, (const uint8_t *) ctx->key,
+                       (const uint8_t *) ctx->nonce, ctx->ctr++);
+        for (size_t i = 0; i < inlen; i++)
+            out[i] = in[i] ^ ks[i];
+        ctx->left = 64 - inlen;
+    }
+}
 
-    /* if a, b is normal */
-    if (exp_a)
-        mant_a |= 0x80;
-    if (exp_b)
-        mant_b |= 0x80;
+static void chacha20_ctx_final(chacha20_ctx_t *ctx)
+{
+    uint32_t *w = (uint32_t *) ctx;
+    for (size_t i = 0; i < sizeof(*ctx) / sizeof(uint32_t); i++)
+        w[i] = 0;
+}
 
-    int16_t exp_diff = exp_a - exp_b;
-    uint16_t result_sign;
-    int16_t result_exp;
-    uint32_t result_mant;
+/* ============= Poly1305 / ChaCha20-Poly1305 ============= */
 
-    /* deal with result of exp */
-    if (exp_diff > 0) {
-        result_exp = exp_b;
-        if (exp_diff > 8)
-            return a;
-        mant_a <<= exp_diff;
-    } else if (exp_diff < 0) {
-        result_exp = exp_a;
-        if (exp_diff < -8)
-            return b;
-        mant_b <<= -exp_diff;
-    } else
-        result_exp = exp_a;
+/* h and r in 26-bit limbs. rtab[k] holds k * r[i] in words 0-4 and
+ * k * 5 * r[i] in words 10-14, so poly1305_asm.S forms h * r from table
+ * lookups, shifts and adds instead of 25 __mulsi3 calls per block. */
+typedef struct {
+    uint32_t rtab[8][16];
+    uint32_t h[5];
+    uint32_t pad[4];
+    uint8_t buf[16];
+    size_t buffered;
+} poly1305_ctx_t;
+
+/* h = (h + m) * r for nblocks 16-byte blocks; hibit is 1 << 24 for full
+ * blocks and 0 for a final block that already carries its 0x01 byte */
+extern void poly1305_blocks(poly1305_ctx_t *st,
+                            const uint8_t *m,
+                            size_t nblocks,
+                            uint32_t hibit);
+
+static inline uint32_t load32_le(const uint8_t *p)
+{
+    return (uint32_t) p[0] | (uint32_t) p[1] << 8 | (uint32_t) p[2] << 16 |
+           (uint32_t) p[3] << 24;
+}
 
-    if (sign_a == sign_b) {
-        result_sign = sign_a;
-        result_mant = (uint32_t) mant_a + mant_b;
-        uint32_t lz = clz(result_mant);
-        for (unsigned i = 0; i < 32 - lz - 8; i++) {
-            result_mant >>= 1;
-            if (++result_exp >= 255)
-                return BF16_NAN();
-        }
-    } else {
-        if (mant_a >= mant_b) {
-            result_sign = sign_a;
-            result_mant = mant_a - mant_b;
-        } else {
-            result_sign = sign_b;
-            result_mant = mant_b - mant_a;
-        }
-        if (!result_mant)
-            return BF16_ZERO();
-        if (result_mant < 0x80) {
-            while (!(result_mant & 0x80)) {
-                result_mant <<= 1;
-                if (--result_exp <= 0)
-                    return BF16_ZERO();
-            }
-        } else {
-            uint32_t lz = clz(result_mant);
-            for (unsigned i = 0; i < 32 - lz - 8; i++) {
-                result_mant >>= 1;
-                if (++result_exp >= 255)
-                    return BF16_NAN();
-            }
+static inline void store32_le(uint8_t *p, uint32_t v)
+{
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+    p[3] = v >> 24;
+}
+
+static void poly1305_init(poly1305_ctx_t *ctx, const uint8_t key[32])
+{
+    uint32_t t0 = load32_le(key), t1 = load32_le(key + 4);
+    uint32_t t2 = load32_le(key + 8), t3 = load32_le(key + 12);
+    uint32_t r[5];
+
+    /* Clamp r while splitting it into limbs */
+    r[0] = t0 & 0x3ffffff;
+    r[1] = ((t0 >> 26) | (t1 << 6)) & 0x3ffff03;
+    r[2] = ((t1 >> 20) | (t2 << 12)) & 0x3ffc0ff;
+    r[3] = ((t2 >> 14) | (t3 << 18)) & 0x3f03fff;
+    r[4] = (t3 >> 8) & 0x00fffff;
+
+    /* Row k is row k - 1 plus r, no multiply needed */
+    for (size_t i = 0; i < 16; i++)
+        ctx->rtab[0][i] = 0;
+    for (size_t k = 1; k < 8; k++) {
+        for (size_t i = 0; i < 5; i++) {
+            ctx->rtab[k][i] = ctx->rtab[k - 1][i] + r[i];
+            ctx->rtab[k][10 + i] =
+                ctx->rtab[k - 1][10 + i] + (r[i] << 2) + r[i];
         }
     }
-    return (bf16_t) {
-        .bits =
-            result_sign << 15 | (result_exp & 0xFF) << 7 | result_mant & 0x7F,
-    };
+
+    for (size_t i = 0; i < 5; i++)
+        ctx->h[i] = 0;
+    for (size_t i = 0; i < 4; i++)
+        ctx->pad[i] = load32_le(key + 16 + 4 * i);
+    ctx->buffered = 0;
 }
 
-static inline bf16_t bf16_sub(bf16_t a, bf16_t b)
+static void poly1305_update(poly1305_ctx_t *ctx, const uint8_t *m, size_t len)
 {
-    b.bits ^= 0x8000U;
-    return bf16_add(a, b);
+    /* Top up a partial block first */
+    if (ctx->buffered) {
+        while (ctx->buffered < 16 && len) {
+            ctx->buf[ctx->buffered++] = *m++;
+            len--;
+        }
+        if (ctx->buffered < 16)
+            return;
+        poly1305_blocks(ctx, ctx->buf, 1, 1 << 24);
+        ctx->buffered = 0;
+    }
+
+    if (len >= 16) {
+        poly1305_blocks(ctx, m, len >> 4, 1 << 24);
+        m += len & ~(size_t) 15;
+        len &= 15;
+    }
+
+    while (len--)
+        ctx->buf[ctx->buffered++] = *m++;
 }
 
-static inline bf16_t bf16_mul(bf16_t a, bf16_t b)
+/* Zero-pad the MAC input to a multiple of 16 bytes */
+static void poly1305_pad16(poly1305_ctx_t *ctx, size_t len)
 {
-    uint16_t sign_a = (a.bits >> 15) & 1;
-    uint16_t sign_b = (b.bits >> 15) & 1;
-    int16_t exp_a = ((a.bits >> 7) & 0xFF);
-    int16_t exp_b = ((b.bits >> 7) & 0xFF);
-    uint16_t mant_a = a.bits & 0x7F;
-    uint16_t mant_b = b.bits & 0x7F;
+    static const uint8_t zeros[16];
 
-    uint16_t result_sign = sign_a ^ sign_b;
+    if (len & 15)
+        poly1305_update(ctx, zeros, 16 - (len & 15));
+}
 
-    if (exp_a == 0xFF) {
-        if (mant_a)
-            return a;
-        if (!exp_b && !mant_b)
-            return BF16_NAN();
-        return (bf16_t) {.bits = (result_sign << 15) | 0x7F80};
-    }
-    if (exp_b == 0xFF) {
-        if (mant_b)
-            return b;
-        if (!exp_a && !mant_a)
-            return BF16_NAN();
-        return (bf16_t) {.bits = (result_sign << 15) | 0x7F80};
+static void poly1305_finish(poly1305_ctx_t *ctx, uint8_t mac[16])
+{
+    uint32_t h0, h1, h2, h3, h4, g0, g1, g2, g3, g4, c, mask;
+    uint64_t f;
+
+    /* Last partial block gets its 0x01 byte inline */
+    if (ctx->buffered) {
+        ctx->buf[ctx->buffered++] = 1;
+        while (ctx->buffered < 16)
+            ctx->buf[ctx->buffered++] = 0;
+        poly1305_blocks(ctx, ctx->buf, 1, 0);
     }
-    if ((!exp_a && !mant_a) || (!exp_b && !mant_b))
-        return (bf16_t) {.bits = result_sign << 15};
 
-    int16_t exp_adjust = 0;
-    if (!exp_a) {
-        while (!(mant_a & 0x80)) {
-            mant_a <<= 1;
-            exp_adjust--;
-        }
-        exp_a = 1;
-    } else
-        mant_a |= 0x80;
-    if (!exp_b) {
-        while (!(mant_b & 0x80)) {
-            mant_b <<= 1;
-            exp_adjust--;
-        }
-        exp_b = 1;
-    } else
-        mant_b |= 0x80;
+    /* Fully carry h */
+    h0 = ctx->h[0];
+    h1 = ctx->h[1];
+    h2 = ctx->h[2];
+    h3 = ctx->h[3];
+    h4 = ctx->h[4];
+    c = h1 >> 26;
+    h1 &= 0x3ffffff;
+    h2 += c;
+    c = h2 >> 26;
+    h2 &= 0x3ffffff;
+    h3 += c;
+    c = h3 >> 26;
+    h3 &= 0x3ffffff;
+    h4 += c;
+    c = h4 >> 26;
+    h4 &= 0x3ffffff;
+    h0 += (c << 2) + c;
+    c = h0 >> 26;
+    h0 &= 0x3ffffff;
+    h1 += c;
+
+    /* g = h + 5 - 2^130, keep it when it did not borrow */
+    g0 = h0 + 5;
+    c = g0 >> 26;
+    g0 &= 0x3ffffff;
+    g1 = h1 + c;
+    c = g1 >> 26;
+    g1 &= 0x3ffffff;
+    g2 = h2 + c;
+    c = g2 >> 26;
+    g2 &= 0x3ffffff;
+    g3 = h3 + c;
+    c = g3 >> 26;
+    g3 &= 0x3ffffff;
+    g4 = h4 + c - (1 << 26);
+
+    mask = (g4 >> 31) - 1;
+    h0 = (h0 & ~mask) | (g0 & mask);
+    h1 = (h1 & ~mask) | (g1 & mask);
+    h2 = (h2 & ~mask) | (g2 & mask);
+    h3 = (h3 & ~mask) | (g3 & mask);
+    h4 = (h4 & ~mask) | (g4 & mask);
+
+    /* mac = (h + pad) mod 2^128 */
+    h0 = h0 | (h1 << 26);
+    h1 = (h1 >> 6) | (h2 << 20);
+    h2 = (h2 >> 12) | (h3 << 14);
+    h3 = (h3 >> 18) | (h4 << 8);
+
+    f = (uint64_t) h0 + ctx->pad[0];
+    store32_le(mac, (uint32_t) f);
+    f = (uint64_t) h1 + ctx->pad[1] + (f >> 32);
+    store32_le(mac + 4, (uint32_t) f);
+    f = (uint64_t) h2 + ctx->pad[2] + (f >> 32);
+    store32_le(mac + 8, (uint32_t) f);
+    f = (uint64_t) h3 + ctx->pad[3] + (f >> 32);
+    store32_le(mac + 12, (uint32_t) f);
+
+    uint32_t *w = (uint32_t *) ctx;
+    for (size_t i = 0; i < sizeof(*ctx) / sizeof(uint32_t); i++)
+        w[i] = 0;
+}
+
+/* One-time Poly1305 key from block 0, RFC 7539 section 2.6 */
+static void chacha20_poly1305_init(poly1305_ctx_t *mac,
+                                   const uint8_t *key,
+                                   const uint8_t *nonce,
+                                   const uint8_t *aad,
+                                   size_t aadlen)
+{
+    uint32_t ks[16];
 
-    uint32_t result_mant = (uint32_t) mant_a * mant_b;
-    int32_t result_exp = (int32_t) exp_a + exp_b - BF16_EXP_BIAS + exp_adjust;
+    chacha20_block(ks, key, nonce, 0);
+    poly1305_init(mac, (const uint8_t *) ks);
+    for (size_t i = 0; i < 16; i++)
+        ks[i] = 0;
 
-    if (result_mant & 0x8000) {
-        result_mant = (result_mant >> 8) & 0x7F;
-        result_exp++;
-    } else
-        result_mant = (result_mant >> 7) & 0x7F;
+    poly1305_update(mac, aad, aadlen);
+    poly1305_pad16(mac, aadlen);
+}
 
-    if (result_exp >= 0xFF)
-        return (bf16_t) {.bits = (result_sign << 15) | 0x7F80};
-    if (result_exp <= 0) {
-        if (result_exp < -6)
-            return (bf16_t) {.bits = result_sign << 15};
-        result_mant >>= (1 - result_exp);
-        result_exp = 0;
-    }
+static void chacha20_poly1305_final(poly1305_ctx_t *mac,
+                                    size_t aadlen,
+                                    size_t len,
+                                    uint8_t tag[16])
+{
+    uint8_t lens[16] = {0};
 
-    return (bf16_t) {.bits = (result_sign << 15) | ((result_exp & 0xFF) << 7) |
-                             (result_mant & 0x7F)};
+    poly1305_pad16(mac, len);
+    store32_le(lens, aadlen);
+    store32_le(lens + 8, len);
+    poly1305_update(mac, lens, sizeof(lens));
+    poly1305_finish(mac, tag);
 }
 
-static inline bf16_t bf16_div(bf16_t a, bf16_t b)
+/* Encrypt and authenticate in one pass: each 64-byte block is MACed
+ * right after it is encrypted, while it is still in the cache */
+static void chacha20_poly1305_seal(uint8_t *out,
+                                   uint8_t tag[16],
+                                   const uint8_t *in,
+                                   size_t len,
+                                   const uint8_t *aad,
+                                   size_t aadlen,
+                                   const uint8_t *key,
+                                   const uint8_t *nonce)
 {
-    uint16_t sign_a = (a.bits >> 15) & 1;
-    uint16_t sign_b = (b.bits >> 15) & 1;
-    int16_t exp_a = ((a.bits >> 7) & 0xFF);
-    int16_t exp_b = ((b.bits >> 7) & 0xFF);
-    uint16_t mant_a = a.bits & 0x7F;
-    uint16_t mant_b = b.bits & 0x7F;
+    poly1305_ctx_t mac;
 
-    uint16_t result_sign = sign_a ^ sign_b;
+    chacha20_poly1305_init(&mac, key, nonce, aad, aadlen);
+    for (size_t off = 0; off < len; off += 64) {
+        size_t n = len - off < 64 ? len - off : 64;
+        chacha20(out + off, in + off, n, key, nonce, 1 + (off >> 6));
+        poly1305_update(&mac, out + off, n);
+    }
+    chacha20_poly1305_final(&mac, aadlen, len, tag);
+}
 
-    if (exp_b == 0xFF) {
-        if (mant_b)
-            return b;
-        /* Inf/Inf = NaN */
-        if (exp_a == 0xFF && !mant_a)
-            return BF16_NAN();
-        return (bf16_t) {.bits = result_sign << 15};
-    }
-    if (!exp_b && !mant_b) {
-        if (!exp_a && !mant_a)
-            return BF16_NAN();
-        return (bf16_t) {.bits = (result_sign << 15) | 0x7F80};
-    }
-    if (exp_a == 0xFF) {
-        if (mant_a)
-            return a;
-        return (bf16_t) {.bits = (result_sign << 15) | 0x7F80};
+/* MAC each block before decrypting it, so out may alias in. On a tag
+ * mismatch out is wiped and false is returned. */
+static bool chacha20_poly1305_open(uint8_t *out,
+                                   const uint8_t *in,
+                                   size_t len,
+                                   const uint8_t tag[16],
+                                   const uint8_t *aad,
+                                   size_t aadlen,
+                                   const uint8_t *key,
+                                   const uint8_t *nonce)
+{
+    poly1305_ctx_t mac;
+    uint8_t calc[16];
+    uint8_t diff = 0;
+
+    chacha20_poly1305_init(&mac, key, nonce, aad, aadlen);
+    for (size_t off = 0; off < len; off += 64) {
+        size_t n = len - off < 64 ? len - off : 64;
+        poly1305_update(&mac, in + off, n);
+        chacha20(out + off, in + off, n, key, nonce, 1 + (off >> 6));
     }
-    if (!exp_a && !mant_a)
-        return (bf16_t) {.bits = result_sign << 15};
+    chacha20_poly1305_final(&mac, aadlen, len, calc);
+
+    /* Constant time compare */
+    for (size_t i = 0; i < 16; i++)
+        diff |= calc[i] ^ tag[i];
+    if (diff) {
+        for (size_t i = 0; i < len; i++)
+            out[i] = 0;
+        return false;
+    }
+    return true;
+}
 
-    if (exp_a)
-        mant_a |= 0x80;
-    if (exp_b)
-        mant_b |= 0x80;
+/* ============= ChaCha20 Keystream Cache ============= */
+
+/* Blocks kept in .bss, e.g. make CHACHA20_CACHE_BLOCKS=32 */
+#ifndef CHACHA20_CACHE_BLOCKS
+#define CHACHA20_CACHE_BLOCKS 8
+#endif
+
+typedef struct {
+    uint32_t keystream[16];
+    uint32_t key_id;
+    uint32_t nonce[3];
+    uint32_t ctr;
+    uint32_t last_use; /* 0 marks an empty slot */
+} chacha20_cache_entry_t;
+
+static chacha20_cache_entry_t chacha20_cache[CHACHA20_CACHE_BLOCKS];
+static uint32_t chacha20_cache_clock;
+static uint32_t chacha20_cache_hits;
+static uint32_t chacha20_cache_misses;
+
+/* Must be called when the key behind a key_id changes */
+static void chacha20_cache_flush(void)
+{
+    uint32_t *w = (uint32_t *) chacha20_cache;
+    for (size_t i = 0; i < sizeof(chacha20_cache) / sizeof(uint32_t); i++)
+        w[i] = 0;
+    chacha20_cache_clock = 0;
+}
 
-    uint32_t dividend = (uint32_t) mant_a << 15;
-    uint32_t divisor = mant_b;
-    uint32_t quotient = 0;
+/* Keystream block for (key_id, nonce, ctr), generated on a miss into
+ * the least recently used slot */
+static const uint32_t *chacha20_cache_get(uint32_t key_id,
+                                          const uint8_t *key,
+                                          const uint8_t *nonce,
+                                          uint32_t ctr)
+{
+    uint32_t n0 = load32_le(nonce), n1 = load32_le(nonce + 4);
+    uint32_t n2 = load32_le(nonce + 8);
+    chacha20_cache_entry_t *victim = &chacha20_cache[0];
+
+    /* Restart the clock before it wraps onto the empty marker */
+    if (++chacha20_cache_clock == 0) {
+        chacha20_cache_flush();
+        chacha20_cache_clock = 1;
+    }
 
-    for (int i = 0; i < 16; i++) {
-        quotient <<= 1;
-        if (dividend >= (divisor << (15 - i))) {
-            dividend -= (divisor << (15 - i));
-            quotient |= 1;
+    for (size_t i = 0; i < CHACHA20_CACHE_BLOCKS; i++) {
+        chacha20_cache_entry_t *e = &chacha20_cache[i];
+        if (e->last_use && e->ctr == ctr && e->key_id == key_id &&
+            e->nonce[0] == n0 && e->nonce[1] == n1 && e->nonce[2] == n2) {
+            e->last_use = chacha20_cache_clock;
+            chacha20_cache_hits++;
+            return e->keystream;
         }
+        if (e->last_use < victim->last_use)
+            victim = e;
     }
 
-    int32_t result_exp = (int32_t) exp_a - exp_b + BF16_EXP_BIAS;
+    chacha20_block(victim->keystream, key, nonce, ctr);
+    victim->key_id = key_id;
+    victim->nonce[0] = n0;
+    victim->nonce[1] = n1;
+    victim->nonce[2] = n2;
+    victim->ctr = ctr;
+    victim->last_use = chacha20_cache_clock;
+    chacha20_cache_misses++;
+    return victim->keystream;
+}
+
+/* chacha20 with keystream blocks served from the cache. key_id names
+ * the key for lookups, key itself is only read on a miss. */
+static void chacha20_cached(uint8_t *out,
+                            const uint8_t *in,
+                            size_t inlen,
+                            uint32_t key_id,
+                            const uint8_t *key,
+                            const uint8_t *nonce,
+                            uint32_t ctr)
+{
+    bool aligned = !(((uintptr_t) out | (uintptr_t) in) & 3);
 
-    if (!exp_a)
-        result_exp--;
-    if (!exp_b)
-        result_exp++;
+    while (inlen) {
+        const uint32_t *ks = chacha20_cache_get(key_id, key, nonce, ctr++);
+        size_t n = inlen < 64 ? inlen : 64;
+        size_t i = 0;
 
-    if (quotient & 0x8000)
-        quotient >>= 8;
-    else {
-        while (!(quotient & 0x8000) && result_exp > 1) {
-            quotient <<= 1;
-            result_exp--;
+        if (aligned) {
+            for (; i + 4 <= n; i += 4)
+                *(uint32_t *) (out + i) =
+                    *(const uint32_t *) (in + i) ^ ks[i >> 2];
         }
-        quotient >>= 8;
-    }
-    quotient &= 0x7F;
+        for (; i < n; i++)
+            out[i] = in[i] ^ ((const uint8_t *) ks)[i];
 
-    if (result_exp >= 0xFF)
-        return (bf16_t) {.bits = (result_sign << 15) | 0x7F80};
-    if (result_exp <= 0)
-        return (bf16_t) {.bits = result_sign << 15};
-    return (bf16_t) {.bits = (result_sign << 15) | ((result_exp & 0xFF) << 7) |
-                             (quotient & 0x7F)};
+        out += n;
+        in += n;
+        inlen -= n;
+    }
 }
 
-/* ============= ChaCha20 Declaration ============= */
+/* ============= Test Suite ============= */
 
-extern void chacha20(uint8_t *out,
-                     const uint8_t *in,
-                     size_t inlen,
-                     const uint8_t *key,
-                     const uint8_t *nonce,
-                     uint32_t ctr);
+/* Run fn at every in/out misalignment and in place; the bytes around
+ * the output must stay untouched. */
+static bool chacha20_check_offsets(chacha20_fn fn,
+                                   const uint8_t *in,
+                                   const uint8_t *exp,
+                                   size_t len,
+                                   const uint8_t *key,
+                                   const uint8_t *nonce,
+                                   uint32_t ctr)
+{
+    static uint8_t src[128 + 8], dst[128 + 8];
+
+    for (size_t in_off = 0; in_off < 4; in_off++) {
+        /* out_off 4 means in place */
+        for (size_t out_off = 0; out_off < 5; out_off++) {
+            uint8_t *buf = out_off < 4 ? dst : src;
+            uint8_t *out = out_off < 4 ? dst + out_off : src + in_off;
+            uint8_t fill = out_off < 4 ? 0xA5 : 0x5A;
+
+            for (size_t i = 0; i < sizeof(src); i++) {
+                src[i] = 0x5A;
+                dst[i] = 0xA5;
+            }
+            memcpy(src + in_off, in, len);
 
-/* ============= Test Suite ============= */
+            fn(out, src + in_off, len, key, nonce, ctr);
+
+            for (size_t i = 0; i < len; i++) {
+                if (out[i] != exp[i])
+                    return false;
+            }
+            for (uint8_t *p = buf; p < out; p++) {
+                if (*p != fill)
+                    return false;
+            }
+            for (uint8_t *p = out + len; p < buf + sizeof(src); p++) {
+                if (*p != fill)
+                    return false;
+            }
+        }
+    }
+    return true;
+}
 
 static void test_chacha20(void)
 {
@@ -473,6 +825,12 @@ static void test_chacha20(void)
 
     TEST_LOGGER("Test: ChaCha20\n");
 
+    if (chacha20_zbb) {
+        TEST_LOGGER("  Rotates: Zbb rori\n");
+    } else {
+        TEST_LOGGER("  Rotates: RV32I slli/srli/xor\n");
+    }
+
     /* Run ChaCha20 encryption */
     chacha20(out, in, sizeof(in), key, nonce, ctr);
 
@@ -490,45 +848,684 @@ static void test_chacha20(void)
     } else {
         TEST_LOGGER("  ChaCha20 RFC 7539: FAILED\n");
     }
-}
 
-static void test_bf16_add(void)
-{
-    TEST_LOGGER("Test: bf16_add\n");
+    /* Same vector through the bulk kernel */
+    chacha20_bulk(out, in, sizeof(in), key, nonce, ctr);
 
-    /* 1.0 + 1.0 = 2.0 */
-    bf16_t a = {.bits = 0x3F80}; /* 1.0 */
-    bf16_t b = {.bits = 0x3F80}; /* 1.0 */
-    bf16_t result = bf16_add(a, b);
-    TEST_LOGGER("  1.0 + 1.0 = ");
-    print_hex(result.bits);
+    passed = true;
+    for (size_t i = 0; i < sizeof(exp); i++) {
+        if (out[i] != exp[i]) {
+            passed = false;
+            break;
+        }
+    }
 
-    /* Expected: 0x4000 (2.0) */
-    if (result.bits == 0x4000) {
-        TEST_LOGGER("  PASSED\n");
+    if (passed) {
+        TEST_LOGGER("  ChaCha20 bulk RFC 7539: PASSED\n");
     } else {
-        TEST_LOGGER("  FAILED (expected 0x4000)\n");
+        TEST_LOGGER("  ChaCha20 bulk RFC 7539: FAILED\n");
     }
-}
 
-static void test_bf16_sub(void)
-{
-    TEST_LOGGER("Test: bf16_sub\n");
+    /* Same vector fed through the context in uneven chunks */
+    static const uint8_t chunks[] = {70, 1, 43};
+    chacha20_ctx_t ctx;
+    size_t off = 0;
 
-    /* 3.0 - 2.0 = 1.0 */
-    bf16_t a = {.bits = 0x4040}; /* 3.0 */
-    bf16_t b = {.bits = 0x4000}; /* 2.0 */
-    bf16_t result = bf16_sub(a, b);
-    TEST_LOGGER("  3.0 - 2.0 = ");
-    print_hex(result.bits);
+    chacha20_ctx_init(&ctx, key, nonce, ctr);
+    for (size_t c = 0; c < sizeof(chunks); c++) {
+        chacha20_ctx_update(&ctx, out + off, in + off, chunks[c]);
+        off += chunks[c];
+    }
 
-    /* Expected: 0x3F80 (1.0) */
-    if (result.bits == 0x3F80) {
-        TEST_LOGGER("  PASSED\n");
-    } else {
-        TEST_LOGGER("  FAILED (expected 0x3F80)\n");
+    /* 114 bytes need exactly two blocks */
+    passed = ctx.ctr == ctr + 2;
+    chacha20_ctx_final(&ctx);
+    for (size_t i = 0; i < sizeof(exp); i++) {
+        if (out[i] != exp[i]) {
+            passed = false;
+            break;
+        }
     }
-}
+
+    if (passed) {
+        TEST_LOGGER("  ChaCha20 ctx chunked: PASSED\n");
+    } else {
+        TEST_LOGGER("  ChaCha20 ctx chunked: FAILED\n");
+    }
+
+    /* Byte offsets 0-3 on both buffers, plus in place */
+    passed = chacha20_check_offsets(chacha20, in, exp, sizeof(in), key, nonce,
+                                    ctr) &&
+             chacha20_check_offsets(chacha20_bulk, in, exp, sizeof(in), key,
+                                    nonce, ctr);
+
+    if (passed) {
+        TEST_LOGGER("  ChaCha20 unaligned/in-place: PASSED\n");
+    } else {
+        TEST_LOGGER("  ChaCha20 unaligned/in-place: FAILED\n");
+    }
+
+    /* Cached keystream: two misses, then the same window hits */
+    chacha20_cache_flush();
+    uint32_t hits = chacha20_cache_hits, misses = chacha20_cache_misses;
+
+    passed = true;
+    for (int pass = 0; pass < 2; pass++) {
+        chacha20_cached(out, in, sizeof(in), 1, key, nonce, ctr);
+        for (size_t i = 0; i < sizeof(exp); i++) {
+            if (out[i] != exp[i]) {
+                passed = false;
+                break;
+            }
+        }
+    }
+    passed = passed && chacha20_cache_hits - hits == 2 &&
+             chacha20_cache_misses - misses == 2;
+
+    /* Fill the cache, touch the oldest block again and insert one more:
+     * the block evicted must be the least recently used one, counter 1,
+     * while the re-touched counter 0 stays */
+    chacha20_cache_flush();
+    for (uint32_t c = 0; c < CHACHA20_CACHE_BLOCKS; c++)
+        chacha20_cache_get(2, key, nonce, c);
+    if (CHACHA20_CACHE_BLOCKS > 1) {
+        chacha20_cache_get(2, key, nonce, 0);
+        chacha20_cache_get(2, key, nonce, CHACHA20_CACHE_BLOCKS);
+
+        hits = chacha20_cache_hits;
+        misses = chacha20_cache_misses;
+        chacha20_cache_get(2, key, nonce, 0);
+        passed = passed && chacha20_cache_hits - hits == 1 &&
+                 chacha20_cache_misses == misses;
+        chacha20_cache_get(2, key, nonce, 1);
+        passed = passed && chacha20_cache_misses - misses == 1;
+    }
+    chacha20_cache_flush();
+
+    if (passed) {
+        TEST_LOGGER("  ChaCha20 cached: PASSED\n");
+    } else {
+        TEST_LOGGER("  ChaCha20 cached: FAILED\n");
+    }
+}
+
+static void test_chacha20_poly1305(void)
+{
+    /* Poly1305 test vector from RFC 7539 section 2.5.2 */
+    static const uint8_t mac_key[32] = {
+        0x85, 0xd6, 0xbe, 0x78, 0x57, 0x55, 0x6d, 0x33, 0x7f, 0x44, 0x52,
+        0xfe, 0x42, 0xd5, 0x06, 0xa8, 0x01, 0x03, 0x80, 0x8a, 0xfb, 0x0d,
+        0xb2, 0xfd, 0x4a, 0xbf, 0xf6, 0xaf, 0x41, 0x49, 0xf5, 0x1b};
+    static const uint8_t mac_msg[34] = "Cryptographic Forum Research Group";
+    static const uint8_t mac_exp[16] = {0xa8, 0x06, 0x1d, 0xc1, 0x30, 0x51,
+                                        0x36, 0xc6, 0xc2, 0x2b, 0x8b, 0xaf,
+                                        0x0c, 0x01, 0x27, 0xa9};
+
+    /* AEAD test vector from RFC 7539 section 2.8.2 */
+    const uint8_t key[32] = {
+        0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a,
+        0x8b, 0x8c, 0x8d, 0x8e, 0x8f, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95,
+        0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f};
+    const uint8_t nonce[12] = {0x07, 0x00, 0x00, 0x00, 0x40, 0x41,
+                               0x42, 0x43, 0x44, 0x45, 0x46, 0x47};
+    const uint8_t aad[12] = {0x50, 0x51, 0x52, 0x53, 0xc0, 0xc1,
+                             0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7};
+    uint8_t in[114] =
+        "Ladies and Gentlemen of the class of '99: If I could offer you only "
+        "one tip for the future, sunscreen would be it.";
+    uint8_t out[114], back[114];
+    uint8_t tag[16];
+
+    static const uint8_t exp[114] = {
+        0xd3, 0x1a, 0x8d, 0x34, 0x64, 0x8e, 0x60, 0xdb, 0x7b, 0x86, 0xaf, 0xbc,
+        0x53, 0xef, 0x7e, 0xc2, 0xa4, 0xad, 0xed, 0x51, 0x29, 0x6e, 0x08, 0xfe,
+        0xa9, 0xe2, 0xb5, 0xa7, 0x36, 0xee, 0x62, 0xd6, 0x3d, 0xbe, 0xa4, 0x5e,
+        0x8c, 0xa9, 0x67, 0x12, 0x82, 0xfa, 0xfb, 0x69, 0xda, 0x92, 0x72, 0x8b,
+        0x1a, 0x71, 0xde, 0x0a, 0x9e, 0x06, 0x0b, 0x29, 0x05, 0xd6, 0xa5, 0xb6,
+        0x7e, 0xcd, 0x3b, 0x36, 0x92, 0xdd, 0xbd, 0x7f, 0x2d, 0x77, 0x8b, 0x8c,
+        0x98, 0x03, 0xae, 0xe3, 0x28, 0x09, 0x1b, 0x58, 0xfa, 0xb3, 0x24, 0xe4,
+        0xfa, 0xd6, 0x75, 0x94, 0x55, 0x85, 0x80, 0x8b, 0x48, 0x31, 0xd7, 0xbc,
+        0x3f, 0xf4, 0xde, 0xf0, 0x8e, 0x4b, 0x7a, 0x9d, 0xe5, 0x76, 0xd2, 0x65,
+        0x86, 0xce, 0xc6, 0x4b, 0x61, 0x16};
+    static const uint8_t tag_exp[16] = {0x1a, 0xe1, 0x0b, 0x59, 0x4f, 0x09,
+                                        0xe2, 0x6a, 0x7e, 0x90, 0x2e, 0xcb,
+                                        0xd0, 0x60, 0x06, 0x91};
+
+    TEST_LOGGER("Test: ChaCha20-Poly1305\n");
+
+    /* Feed the message unevenly to cover the partial block buffer */
+    poly1305_ctx_t mac;
+    poly1305_init(&mac, mac_key);
+    poly1305_update(&mac, mac_msg, 5);
+    poly1305_update(&mac, mac_msg + 5, 20);
+    poly1305_update(&mac, mac_msg + 25, sizeof(mac_msg) - 25);
+    poly1305_finish(&mac, tag);
+
+    bool passed = true;
+    for (size_t i = 0; i < sizeof(tag); i++) {
+        if (tag[i] != mac_exp[i]) {
+            passed = false;
+            break;
+        }
+    }
+
+    if (passed) {
+        TEST_LOGGER("  Poly1305 RFC 7539: PASSED\n");
+    } else {
+        TEST_LOGGER("  Poly1305 RFC 7539: FAILED\n");
+    }
+
+    chacha20_poly1305_seal(out, tag, in, sizeof(in), aad, sizeof(aad), key,
+                           nonce);
+
+    passed = true;
+    for (size_t i = 0; i < sizeof(exp); i++) {
+        if (out[i] != exp[i]) {
+            passed = false;
+            break;
+        }
+    }
+    for (size_t i = 0; i < sizeof(tag); i++) {
+        if (tag[i] != tag_exp[i]) {
+            passed = false;
+            break;
+        }
+    }
+
+    if (passed) {
+        TEST_LOGGER("  AEAD seal RFC 7539: PASSED\n");
+    } else {
+        TEST_LOGGER("  AEAD seal RFC 7539: FAILED\n");
+    }
+
+    passed = chacha20_poly1305_open(back, out, sizeof(out), tag, aad,
+                                    sizeof(aad), key, nonce);
+    for (size_t i = 0; i < sizeof(in); i++) {
+        if (back[i] != in[i]) {
+            passed = false;
+            break;
+        }
+    }
+
+    if (passed) {
+        TEST_LOGGER("  AEAD open RFC 7539: PASSED\n");
+    } else {
+        TEST_LOGGER("  AEAD open RFC 7539: FAILED\n");
+    }
+
+    /* One flipped ciphertext bit must be rejected and leave no plaintext */
+    out[57] ^= 0x10;
+    passed = !chacha20_poly1305_open(out, out, sizeof(out), tag, aad,
+                                     sizeof(aad), key, nonce);
+    for (size_t i = 0; i < sizeof(out); i++) {
+        if (out[i]) {
+            passed = false;
+            break;
+        }
+    }
+
+    if (passed) {
+        TEST_LOGGER("  AEAD open tampered: PASSED\n");
+    } else {
+        TEST_LOGGER("  AEAD open tampered: FAILED\n");
+    }
+}
+
+/* One spare byte for the unaligned benchmark */
+static uint8_t chacha20_bench_buf[65536 + 4];
+
+static void bench_chacha20(void)
+{
+    static const size_t sizes[] = {1024, 16384, 65536};
+    const uint8_t key[32] = {0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10,
+                             11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+                             22, 23, 24, 25, 26, 27, 28, 29, 30, 31};
+    const uint8_t nonce[12] = {0, 0, 0, 0, 0, 0, 0, 74, 0, 0, 0, 0};
+    counters_t start;
+    uint64_t cycles;
+
+    TEST_LOGGER("Benchmark: chacha20 vs chacha20_bulk\n");
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t len = sizes[s];
+
+        TEST_LOGGER("  Bytes: ");
+        print_dec(len);
+
+        /* Encrypt in place with the reference kernel... */
+        counters_read(&start);
+        chacha20(chacha20_bench_buf, chacha20_bench_buf, len, key, nonce, 1);
+        cycles = counters_since(&start).cycles;
+        TEST_LOGGER("    chacha20 cycles/byte: ");
+        print_cpb(cycles, len);
+
+        /* ...and decrypt with the bulk one, which must restore zeros */
+        counters_read(&start);
+        chacha20_bulk(chacha20_bench_buf, chacha20_bench_buf, len, key, nonce,
+                      1);
+        cycles = counters_since(&start).cycles;
+        TEST_LOGGER("    chacha20_bulk cycles/byte: ");
+        print_cpb(cycles, len);
+
+        bool passed = true;
+        for (size_t i = 0; i < len; i++) {
+            if (chacha20_bench_buf[i]) {
+                passed = false;
+                break;
+            }
+        }
+        if (passed) {
+            TEST_LOGGER("    Round trip: PASSED\n");
+        } else {
+            TEST_LOGGER("    Round trip: FAILED\n");
+        }
+    }
+}
+
+/* Replay the same window: the first pass fills the cache, the rest
+ * only xor */
+static void bench_chacha20_cache(void)
+{
+    const uint8_t key[32] = {0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10,
+                             11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+                             22, 23, 24, 25, 26, 27, 28, 29, 30, 31};
+    const uint8_t nonce[12] = {0, 0, 0, 0, 0, 0, 0, 74, 0, 0, 0, 0};
+    const size_t len = CHACHA20_CACHE_BLOCKS * 64;
+    counters_t start;
+    uint64_t cycles;
+
+    TEST_LOGGER("Benchmark: chacha20_cached, window of cache size\n");
+    TEST_LOGGER("  Bytes: ");
+    print_dec(len);
+
+    chacha20_cache_flush();
+    chacha20_cache_hits = 0;
+    chacha20_cache_misses = 0;
+
+    for (int pass = 0; pass < 4; pass++) {
+        counters_read(&start);
+        chacha20_cached(chacha20_bench_buf, chacha20_bench_buf, len, 1, key,
+                        nonce, 1);
+        cycles = counters_since(&start).cycles;
+        if (pass == 0) {
+            TEST_LOGGER("    cold cycles/byte: ");
+        } else {
+            TEST_LOGGER("    warm cycles/byte: ");
+        }
+        print_cpb(cycles, len);
+    }
+
+    TEST_LOGGER("  Cache hits: ");
+    print_dec(chacha20_cache_hits);
+    TEST_LOGGER("  Cache misses: ");
+    print_dec(chacha20_cache_misses);
+    chacha20_cache_flush();
+}
+
+/* chacha20 on buffers one byte off word alignment */
+static void chacha20_unaligned(uint8_t *out,
+                               const uint8_t *in,
+                               size_t inlen,
+                               const uint8_t *key,
+                               const uint8_t *nonce,
+                               uint32_t ctr)
+{
+    chacha20(out + 1, in + 1, inlen, key, nonce, ctr);
+}
+
+static const struct {
+    const char *name;
+    chacha20_fn fn;
+} chacha20_kernels[] = {
+    {"chacha20", chacha20},
+    {"chacha20_bulk", chacha20_bulk},
+    {"chacha20_unaligned", chacha20_unaligned},
+};
+
+/* 1 B to 64 KiB, with tails on both sides of the block size */
+static const uint32_t chacha20_bench_sizes[] = {
+    1,    3,    16,   63,   64,   65,    100,   127,   128,   200,
+    256,  1000, 1024, 1500, 4096, 4097,  16384, 16447, 65535, 65536,
+};
+
+#define CHACHA20_BENCH_SIZES \
+    (sizeof(chacha20_bench_sizes) / sizeof(chacha20_bench_sizes[0]))
+#define CHACHA20_BENCH_KERNELS \
+    (sizeof(chacha20_kernels) / sizeof(chacha20_kernels[0]))
+
+static void print_bench_row(const char *name,
+                            uint64_t bytes,
+                            uint64_t cycles,
+                            uint64_t instret)
+{
+    char buf[128];
+    char *end = buf + sizeof(buf) - 1;
+    char *p;
+
+    *end = '\n';
+    p = fmt_ratio(end, instret, bytes);
+    *--p = ',';
+    p = fmt_ratio(p, cycles, bytes);
+    *--p = ',';
+    p = fmt_dec64(p, instret);
+    *--p = ',';
+    p = fmt_dec64(p, cycles);
+    *--p = ',';
+    p = fmt_dec64(p, bytes);
+    *--p = ',';
+
+    console_puts("chacha20_bench,");
+    console_puts(name);
+    TEST_OUTPUT(p, (buf + sizeof(buf) - p));
+}
+
+/* Every kernel over every size; only the kernel call is timed and the
+ * table is printed after all measurements are taken. */
+static void bench_chacha20_sweep(void)
+{
+    static uint64_t cycles[CHACHA20_BENCH_KERNELS][CHACHA20_BENCH_SIZES];
+    static uint64_t instret[CHACHA20_BENCH_KERNELS][CHACHA20_BENCH_SIZES];
+    const uint8_t key[32] = {0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10,
+                             11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+                             22, 23, 24, 25, 26, 27, 28, 29, 30, 31};
+    const uint8_t nonce[12] = {0, 0, 0, 0, 0, 0, 0, 74, 0, 0, 0, 0};
+
+    for (size_t k = 0; k < CHACHA20_BENCH_KERNELS; k++) {
+        for (size_t s = 0; s < CHACHA20_BENCH_SIZES; s++) {
+            counters_t start, elapsed;
+
+            counters_read(&start);
+
+            chacha20_kernels[k].fn(chacha20_bench_buf, chacha20_bench_buf,
+                                   chacha20_bench_sizes[s], key, nonce, 1);
+
+            elapsed = counters_since(&start);
+            cycles[k][s] = elapsed.cycles;
+            instret[k][s] = elapsed.instret;
+        }
+    }
+
+    TEST_LOGGER(
+        "chacha20_bench,kernel,bytes,cycles,instret,cycles_per_byte,"
+        "instret_per_byte\n");
+    for (size_t k = 0; k < CHACHA20_BENCH_KERNELS; k++) {
+        for (size_t s = 0; s < CHACHA20_BENCH_SIZES; s++)
+            print_bench_row(chacha20_kernels[k].name, chacha20_bench_sizes[s],
+                            cycles[k][s], instret[k][s]);
+    }
+}
+
+/* xorshift32, no multiply needed */
+static uint32_t bench_rand(uint32_t *state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+/* Random normal operand whose product stays in range */
+static bf16_t bench_bf16_operand(uint32_t *state)
+{
+    uint32_t r = bench_rand(state);
+    return (bf16_t) {.bits = (r & 0x807F) | ((0x60 + ((r >> 7) & 0x3F)) << 7)};
+}
+
+#define BF16_BENCH_OPS 256
+
+static bf16_t bf16_bench_a[BF16_BENCH_OPS], bf16_bench_b[BF16_BENCH_OPS];
+static bf16_t bf16_bench_r[2][BF16_BENCH_OPS];
+
+/* bf16_add_core before the single-shift normalization, kept so Test 1
+ * and Test 2 can time the two */
+static bf16_t bf16_add_core_loop(bf16_t a, bf16_t b)
+{
+    uint16_t sign_a = a.bits >> 15 & 0x1, sign_b = b.bits >> 15 & 1;
+    int16_t exp_a = a.bits >> 7 & 0xFF, exp_b = b.bits >> 7 & 0xFF;
+    uint16_t mant_a = a.bits & 0x7F, mant_b = b.bits & 0x7F;
+
+    /* if a, b is normal */
+    if (exp_a)
+        mant_a |= 0x80;
+    if (exp_b)
+        mant_b |= 0x80;
+
+    int16_t exp_diff = exp_a - exp_b;
+    uint16_t result_sign;
+    int16_t result_exp;
+    uint32_t result_mant;
+
+    /* deal with result of exp */
+    if (exp_diff > 0) {
+        result_exp = exp_b;
+        if (exp_diff > 8)
+            return a;
+        mant_a <<= exp_diff;
+    } else if (exp_diff < 0) {
+        result_exp = exp_a;
+        if (exp_diff < -8)
+            return b;
+        mant_b <<= -exp_diff;
+    } else
+        result_exp = exp_a;
+
+    if (sign_a == sign_b) {
+        result_sign = sign_a;
+        result_mant = (uint32_t) mant_a + mant_b;
+        uint32_t lz = clz(result_mant);
+        for (unsigned i = 0; i < 32 - lz - 8; i++) {
+            result_mant >>= 1;
+            if (++result_exp >= 255)
+                return BF16_NAN();
+        }
+    } else {
+        if (mant_a >= mant_b) {
+            result_sign = sign_a;
+            result_mant = mant_a - mant_b;
+        } else {
+            result_sign = sign_b;
+            result_mant = mant_b - mant_a;
+        }
+        if (!result_mant)
+            return BF16_ZERO();
+        if (result_mant < 0x80) {
+            while (!(result_mant & 0x80)) {
+                result_mant <<= 1;
+                if (--result_exp <= 0)
+                    return BF16_ZERO();
+            }
+        } else {
+            uint32_t lz = clz(result_mant);
+            for (unsigned i = 0; i < 32 - lz - 8; i++) {
+                result_mant >>= 1;
+                if (++result_exp >= 255)
+                    return BF16_NAN();
+            }
+        }
+    }
+    return (bf16_t) {
+        .bits =
+            result_sign << 15 | (result_exp & 0xFF) << 7 | result_mant & 0x7F,
+    };
+}
+
+/* Random operand pairs at most 8 binades apart, so every add reaches the
+ * normalization stage; half of them have opposite signs */
+static void bench_bf16_add(bool negate_b)
+{
+    uint32_t state = 0x2545F491;
+    counters_t start;
+    uint64_t cycles[2];
+
+    for (size_t i = 0; i < BF16_BENCH_OPS; i++) {
+        uint32_t r = bench_rand(&state);
+        bf16_bench_a[i] = bench_bf16_operand(&state);
+        uint32_t exp = ((bf16_bench_a[i].bits >> 7) & 0xFF) + (r & 15) - 8;
+        bf16_bench_b[i].bits = (r >> 16 & 0x807F) | exp << 7;
+        if (negate_b)
+            bf16_bench_b[i].bits ^= 0x8000;
+    }
+
+    counters_read(&start);
+    for (size_t i = 0; i < BF16_BENCH_OPS; i++)
+        bf16_bench_r[0][i] =
+            bf16_add_core_loop(bf16_bench_a[i], bf16_bench_b[i]);
+    cycles[0] = counters_since(&start).cycles;
+
+    counters_read(&start);
+    for (size_t i = 0; i < BF16_BENCH_OPS; i++)
+        bf16_bench_r[1][i] = bf16_add_core(bf16_bench_a[i], bf16_bench_b[i]);
+    cycles[1] = counters_since(&start).cycles;
+
+    TEST_LOGGER("  Loop normalization cycles/op: ");
+    print_cpb(cycles[0], BF16_BENCH_OPS);
+    TEST_LOGGER("  Single-shift normalization cycles/op: ");
+    print_cpb(cycles[1], BF16_BENCH_OPS);
+
+#if !BF16_ROUND_NEAREST
+    /* The operands keep every result normal, where both must agree */
+    bool passed = true;
+    for (size_t i = 0; i < BF16_BENCH_OPS; i++) {
+        if (bf16_bench_r[0][i].bits != bf16_bench_r[1][i].bits) {
+            passed = false;
+            break;
+        }
+    }
+
+    if (passed) {
+        TEST_LOGGER("  Normalizations agree: PASSED\n");
+    } else {
+        TEST_LOGGER("  Normalizations agree: FAILED\n");
+    }
+#endif
+}
+
+static bf16_t bf16_vector_r[BF16_VECTORS];
+
+/* Sampled pairs from bf16_vectors.h against the host reference results
+ * for op 0-3 (add, sub, mul, div); make host-test covers every pair */
+static void test_bf16_vectors(int op)
+{
+    static bf16_t (*const fn[4])(bf16_t, bf16_t) = {bf16_add, bf16_sub,
+                                                    bf16_mul, bf16_div};
+    const size_t col = 2 + op + (BF16_ROUND_NEAREST ? 4 : 0);
+    counters_t start;
+
+    counters_read(&start);
+    for (size_t i = 0; i < BF16_VECTORS; i++)
+        bf16_vector_r[i] = fn[op]((bf16_t) {.bits = bf16_vectors[i][0]},
+                                  (bf16_t) {.bits = bf16_vectors[i][1]});
+    uint64_t cycles = counters_since(&start).cycles;
+
+    TEST_LOGGER("  Sampled pairs cycles/op: ");
+    print_cpb(cycles, BF16_VECTORS);
+
+    for (size_t i = 0; i < BF16_VECTORS; i++) {
+        bf16_t r = bf16_vector_r[i], ref = {.bits = bf16_vectors[i][col]};
+
+        /* Any NaN will do for a NaN reference */
+        if (r.bits == ref.bits || (bf16_isnan(r) && bf16_isnan(ref)))
+            continue;
+        TEST_LOGGER("  Sampled pairs: FAILED, first mismatch at pair ");
+        print_dec(i);
+        TEST_LOGGER("    a: ");
+        print_hex(bf16_vectors[i][0]);
+        TEST_LOGGER("    b: ");
+        print_hex(bf16_vectors[i][1]);
+        TEST_LOGGER("    result: ");
+        print_hex(r.bits);
+        TEST_LOGGER("    expected: ");
+        print_hex(ref.bits);
+        return;
+    }
+    TEST_LOGGER("  Sampled pairs: PASSED\n");
+}
+
+static void test_bf16_add(void)
+{
+    TEST_LOGGER("Test: bf16_add\n");
+
+    /* 1.0 + 1.0 = 2.0 */
+    bf16_t a = {.bits = 0x3F80}; /* 1.0 */
+    bf16_t b = {.bits = 0x3F80}; /* 1.0 */
+    bf16_t result = bf16_add(a, b);
+    TEST_LOGGER("  1.0 + 1.0 = ");
+    print_hex(result.bits);
+
+    /* Expected: 0x4000 (2.0) */
+    if (result.bits == 0x4000) {
+        TEST_LOGGER("  PASSED\n");
+    } else {
+        TEST_LOGGER("  FAILED (expected 0x4000)\n");
+    }
+
+    bench_bf16_add(false);
+    test_bf16_vectors(0);
+}
+
+static void test_bf16_sub(void)
+{
+    TEST_LOGGER("Test: bf16_sub\n");
+
+    /* 3.0 - 2.0 = 1.0 */
+    bf16_t a = {.bits = 0x4040}; /* 3.0 */
+    bf16_t b = {.bits = 0x4000}; /* 2.0 */
+    bf16_t result = bf16_sub(a, b);
+    TEST_LOGGER("  3.0 - 2.0 = ");
+    print_hex(result.bits);
+
+    /* Expected: 0x3F80 (1.0) */
+    if (result.bits == 0x3F80) {
+        TEST_LOGGER("  PASSED\n");
+    } else {
+        TEST_LOGGER("  FAILED (expected 0x3F80)\n");
+    }
+
+    bench_bf16_add(true);
+    test_bf16_vectors(1);
+}
+
+/* Same random operands through both mantissa engines */
+static void bench_bf16_mul(void)
+{
+    uint32_t state = 0x2545F491;
+    counters_t start;
+    uint64_t cycles[2];
+
+    for (size_t i = 0; i < BF16_BENCH_OPS; i++) {
+        bf16_bench_a[i] = bench_bf16_operand(&state);
+        bf16_bench_b[i] = bench_bf16_operand(&state);
+    }
+
+    for (int qsq = 0; qsq < 2; qsq++) {
+        counters_read(&start);
+        for (size_t i = 0; i < BF16_BENCH_OPS; i++)
+            bf16_bench_r[qsq][i] =
+                bf16_mul_engine(bf16_bench_a[i], bf16_bench_b[i], qsq);
+        cycles[qsq] = counters_since(&start).cycles;
+    }
+
+    TEST_LOGGER("  __mulsi3 cycles/op: ");
+    print_cpb(cycles[0], BF16_BENCH_OPS);
+    TEST_LOGGER("  Quarter-square cycles/op: ");
+    print_cpb(cycles[1], BF16_BENCH_OPS);
+
+    bool passed = true;
+    for (size_t i = 0; i < BF16_BENCH_OPS; i++) {
+        if (bf16_bench_r[0][i].bits != bf16_bench_r[1][i].bits) {
+            passed = false;
+            break;
+        }
+    }
+
+    if (passed) {
+        TEST_LOGGER("  Engines agree: PASSED\n");
+    } else {
+        TEST_LOGGER("  Engines agree: FAILED\n");
+    }
+}
 
 static void test_bf16_mul(void)
 {
@@ -547,6 +1544,26 @@ static void test_bf16_mul(void)
     } else {
         TEST_LOGGER("  FAILED (expected 0x40C0)\n");
     }
+
+    /* Every pair of normalized mantissas */
+    bool passed = true;
+    for (uint32_t ma = 0x80; ma < 0x100 && passed; ma++) {
+        for (uint32_t mb = 0x80; mb < 0x100; mb++) {
+            if (bf16_mant_mul_qsq(ma, mb) != ma * mb) {
+                passed = false;
+                break;
+            }
+        }
+    }
+
+    if (passed) {
+        TEST_LOGGER("  Quarter-square 8x8 products: PASSED\n");
+    } else {
+        TEST_LOGGER("  Quarter-square 8x8 products: FAILED\n");
+    }
+
+    bench_bf16_mul();
+    test_bf16_vectors(2);
 }
 
 static void test_bf16_div(void)
@@ -566,6 +1583,78 @@ static void test_bf16_div(void)
     } else {
         TEST_LOGGER("  FAILED (expected 0x4040)\n");
     }
+
+    /* Random normal operands; make host-test covers every pair */
+    uint32_t state = 0x2545F491;
+    for (size_t i = 0; i < BF16_BENCH_OPS; i++) {
+        bf16_bench_a[i] = bench_bf16_operand(&state);
+        bf16_bench_b[i] = bench_bf16_operand(&state);
+    }
+    counters_t start;
+
+    counters_read(&start);
+    for (size_t i = 0; i < BF16_BENCH_OPS; i++)
+        bf16_bench_r[0][i] = bf16_div(bf16_bench_a[i], bf16_bench_b[i]);
+    uint64_t cycles = counters_since(&start).cycles;
+
+    TEST_LOGGER("  Radix-4 cycles/op: ");
+    print_cpb(cycles, BF16_BENCH_OPS);
+    test_bf16_vectors(3);
+}
+
+/* Normal operands through the classification chain, which is now the
+ * cold path, and through the single-branch fast path */
+static void bench_bf16_dispatch(void)
+{
+    static bf16_t (*const chain[3])(bf16_t, bf16_t) = {
+        bf16_add_special, bf16_mul_special, bf16_div_special};
+    static bf16_t (*const fast[3])(bf16_t, bf16_t) = {bf16_add, bf16_mul,
+                                                      bf16_div};
+    uint32_t state = 0x2545F491;
+    counters_t start;
+    uint64_t cycles[3][2];
+    bool passed = true;
+
+    for (size_t i = 0; i < BF16_BENCH_OPS; i++) {
+        bf16_bench_a[i] = bench_bf16_operand(&state);
+        bf16_bench_b[i] = bench_bf16_operand(&state);
+    }
+
+    for (int k = 0; k < 3; k++) {
+        counters_read(&start);
+        for (size_t i = 0; i < BF16_BENCH_OPS; i++)
+            bf16_bench_r[0][i] = chain[k](bf16_bench_a[i], bf16_bench_b[i]);
+        cycles[k][0] = counters_since(&start).cycles;
+
+        counters_read(&start);
+        for (size_t i = 0; i < BF16_BENCH_OPS; i++)
+            bf16_bench_r[1][i] = fast[k](bf16_bench_a[i], bf16_bench_b[i]);
+        cycles[k][1] = counters_since(&start).cycles;
+
+        for (size_t i = 0; i < BF16_BENCH_OPS; i++) {
+            if (bf16_bench_r[0][i].bits != bf16_bench_r[1][i].bits)
+                passed = false;
+        }
+    }
+
+    TEST_LOGGER("  add branch chain cycles/op: ");
+    print_cpb(cycles[0][0], BF16_BENCH_OPS);
+    TEST_LOGGER("  add fast path cycles/op: ");
+    print_cpb(cycles[0][1], BF16_BENCH_OPS);
+    TEST_LOGGER("  mul branch chain cycles/op: ");
+    print_cpb(cycles[1][0], BF16_BENCH_OPS);
+    TEST_LOGGER("  mul fast path cycles/op: ");
+    print_cpb(cycles[1][1], BF16_BENCH_OPS);
+    TEST_LOGGER("  div branch chain cycles/op: ");
+    print_cpb(cycles[2][0], BF16_BENCH_OPS);
+    TEST_LOGGER("  div fast path cycles/op: ");
+    print_cpb(cycles[2][1], BF16_BENCH_OPS);
+
+    if (passed) {
+        TEST_LOGGER("  Dispatch paths agree: PASSED\n");
+    } else {
+        TEST_LOGGER("  Dispatch paths agree: FAILED\n");
+    }
 }
 
 static void test_bf16_special_cases(void)
@@ -581,24 +1670,321 @@ static void test_bf16_special_cases(void)
         TEST_LOGGER("FAILED\n");
     }
 
-    /* Test NaN */
-    bf16_t nan = BF16_NAN();
-    TEST_LOGGER("  bf16_isnan(NaN): ");
-    if (bf16_isnan(nan)) {
-        TEST_LOGGER("PASSED\n");
-    } else {
-        TEST_LOGGER("FAILED\n");
+    /* Test NaN */
+    bf16_t nan = BF16_NAN();
+    TEST_LOGGER("  bf16_isnan(NaN): ");
+    if (bf16_isnan(nan)) {
+        TEST_LOGGER("PASSED\n");
+    } else {
+        TEST_LOGGER("FAILED\n");
+    }
+
+    /* Test infinity */
+    bf16_t inf = {.bits = 0x7F80};
+    TEST_LOGGER("  bf16_isinf(Inf): ");
+    if (bf16_isinf(inf)) {
+        TEST_LOGGER("PASSED\n");
+    } else {
+        TEST_LOGGER("FAILED\n");
+    }
+
+    bench_bf16_dispatch();
+}
+
+#define BF16_ARRAY_N 1024
+
+/* Word storage keeps the arrays 4-byte aligned for the paired path */
+static uint32_t bf16_array_x[BF16_ARRAY_N / 2], bf16_array_y[BF16_ARRAY_N / 2];
+static uint32_t bf16_array_z[BF16_ARRAY_N / 2], bf16_array_r[BF16_ARRAY_N / 2];
+
+static bool bf16_array_equal(const bf16_t *a, const bf16_t *b, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        if (a[i].bits != b[i].bits)
+            return false;
+    }
+    return true;
+}
+
+static void print_array_result(bool passed, uint64_t cycles)
+{
+    TEST_LOGGER("    cycles/element: ");
+    print_cpb(cycles, BF16_ARRAY_N);
+    if (passed) {
+        TEST_LOGGER("    PASSED\n");
+    } else {
+        TEST_LOGGER("    FAILED\n");
+    }
+}
+
+static void test_bf16_fma(void)
+{
+    TEST_LOGGER("Test: bf16_fma\n");
+
+    /* (1 + 2^-7) * (1 + 3 * 2^-7) - 1 = 2^-5 + 3 * 2^-14: the low term
+     * is 3/4 ulp of the result and is lost if the product is rounded
+     * to bf16 before the add */
+    bf16_t a = {.bits = 0x3F81};
+    bf16_t b = {.bits = 0x3F83};
+    bf16_t c = {.bits = 0xBF80}; /* -1.0 */
+    bf16_t result = bf16_fma(a, b, c);
+    TEST_LOGGER("  1.0078125 * 1.0234375 - 1.0 = ");
+    print_hex(result.bits);
+
+#if BF16_ROUND_NEAREST
+    const uint16_t expected = 0x3D01;
+#else
+    const uint16_t expected = 0x3D00;
+#endif
+    if (result.bits == expected) {
+        TEST_LOGGER("  PASSED\n");
+    } else {
+        TEST_LOGGER("  FAILED (expected ");
+        print_hex(expected);
+        TEST_LOGGER(")\n");
+    }
+
+    /* Inf * 0 + 1.0 = NaN */
+    bf16_t inf = {.bits = 0x7F80};
+    result = bf16_fma(inf, BF16_ZERO(), (bf16_t) {.bits = 0x3F80});
+    TEST_LOGGER("  Inf * 0 + 1.0 = ");
+    print_hex(result.bits);
+    if (bf16_isnan(result)) {
+        TEST_LOGGER("  PASSED\n");
+    } else {
+        TEST_LOGGER("  FAILED (expected NaN)\n");
+    }
+}
+
+static void test_bf16_arrays(void)
+{
+    bf16_t *x = (bf16_t *) bf16_array_x, *y = (bf16_t *) bf16_array_y;
+    bf16_t *z = (bf16_t *) bf16_array_z, *r = (bf16_t *) bf16_array_r;
+    const bf16_t a = {.bits = 0x3FC0}; /* 1.5 */
+    uint32_t state = 0x9E3779B9;
+    counters_t start;
+    uint64_t cycles;
+
+    TEST_LOGGER("Test: bf16 array kernels, 1024 elements\n");
+
+    for (size_t i = 0; i < BF16_ARRAY_N; i++) {
+        x[i] = bench_bf16_operand(&state);
+        y[i] = bench_bf16_operand(&state);
+    }
+
+    TEST_LOGGER("  bf16_vadd\n");
+    counters_read(&start);
+    bf16_vadd(z, x, y, BF16_ARRAY_N);
+    cycles = counters_since(&start).cycles;
+    for (size_t i = 0; i < BF16_ARRAY_N; i++)
+        r[i] = bf16_add(x[i], y[i]);
+    print_array_result(bf16_array_equal(z, r, BF16_ARRAY_N), cycles);
+
+    TEST_LOGGER("  bf16_vmul\n");
+    counters_read(&start);
+    bf16_vmul(z, x, y, BF16_ARRAY_N);
+    cycles = counters_since(&start).cycles;
+    for (size_t i = 0; i < BF16_ARRAY_N; i++)
+        r[i] = bf16_mul(x[i], y[i]);
+    print_array_result(bf16_array_equal(z, r, BF16_ARRAY_N), cycles);
+
+    TEST_LOGGER("  bf16_axpy\n");
+    for (size_t i = 0; i < BF16_ARRAY_N; i++) {
+        z[i] = y[i];
+        r[i] = bf16_fma(a, x[i], y[i]);
+    }
+    counters_read(&start);
+    bf16_axpy(z, a, x, BF16_ARRAY_N);
+    cycles = counters_since(&start).cycles;
+    print_array_result(bf16_array_equal(z, r, BF16_ARRAY_N), cycles);
+
+    TEST_LOGGER("  bf16_dot\n");
+    uint32_t acc = 0;
+    for (size_t i = 0; i < BF16_ARRAY_N; i++)
+        acc = f32_add(acc, bf16_mul_f32(x[i], y[i]));
+    counters_read(&start);
+    f32_t dot = bf16_dot(x, y, BF16_ARRAY_N);
+    cycles = counters_since(&start).cycles;
+
+    /* 1*4 + 2*5 + 3*6 = 32 */
+    static const bf16_t u[3] = {{0x3F80}, {0x4000}, {0x4040}};
+    static const bf16_t v[3] = {{0x4080}, {0x40A0}, {0x40C0}};
+    print_array_result(dot.bits == acc && bf16_dot(u, v, 3).bits == 0x42000000,
+                       cycles);
+
+    /* A NaN, an infinity and a zero send the kernels down the
+     * per-element path, which must give the scalar results */
+    x[5].bits = 0x7FC0;
+    y[6].bits = 0xFF80;
+    x[7].bits = 0x0000;
+    bf16_vadd(z, x, y, BF16_ARRAY_N);
+    for (size_t i = 0; i < BF16_ARRAY_N; i++)
+        r[i] = bf16_add(x[i], y[i]);
+    bool passed = bf16_array_equal(z, r, BF16_ARRAY_N);
+    bf16_vmul(z, x, y, BF16_ARRAY_N);
+    for (size_t i = 0; i < BF16_ARRAY_N; i++)
+        r[i] = bf16_mul(x[i], y[i]);
+    passed = passed && bf16_array_equal(z, r, BF16_ARRAY_N);
+    passed = passed && (bf16_dot(x, y, BF16_ARRAY_N).bits & 0x7FC00000) ==
+                           0x7FC00000;
+
+    if (passed) {
+        TEST_LOGGER("  Special-value fallback: PASSED\n");
+    } else {
+        TEST_LOGGER("  Special-value fallback: FAILED\n");
+    }
+}
+
+#define BF16_CONVERT_N 4096
+
+static uint32_t bf16_convert_f32[BF16_CONVERT_N];
+static uint32_t bf16_convert_bf16[BF16_CONVERT_N / 2];
+
+/* Throughput of one conversion pass over BF16_CONVERT_N elements */
+static void print_convert_result(bool passed, uint64_t cycles)
+{
+    TEST_LOGGER("    elements/cycle: ");
+    print_cpb(BF16_CONVERT_N, cycles);
+    TEST_LOGGER("    cycles/element: ");
+    print_cpb(cycles, BF16_CONVERT_N);
+    if (passed) {
+        TEST_LOGGER("    PASSED\n");
+    } else {
+        TEST_LOGGER("    FAILED\n");
+    }
+}
+
+static void test_bf16_convert(void)
+{
+    f32_t *f = (f32_t *) bf16_convert_f32;
+    bf16_t *h = (bf16_t *) bf16_convert_bf16;
+    uint32_t state = 0x2545F491;
+    counters_t start;
+    uint64_t cycles;
+    bool passed;
+
+    TEST_LOGGER("Test: bf16 <-> fp32 conversion, 4096 elements\n");
+
+    /* Ties to even, carry into the exponent, overflow and a signaling
+     * NaN, then random bit patterns */
+    static const uint32_t edge[8] = {0x3F800000, 0x3F808000, 0x3F818000,
+                                     0x3F80FFFF, 0x7F7FFFFF, 0xFF7F8000,
+                                     0x7F800001, 0x80000001};
+    static const uint16_t edge_bf16[8] = {0x3F80, 0x3F80, 0x3F82, 0x3F81,
+                                          0x7F80, 0xFF80, 0x7FC0, 0x8000};
+    for (size_t i = 0; i < BF16_CONVERT_N; i++)
+        f[i].bits = i < 8 ? edge[i] : bench_rand(&state);
+
+    TEST_LOGGER("  bf16_from_f32_array\n");
+    counters_read(&start);
+    bf16_from_f32_array(h, f, BF16_CONVERT_N);
+    cycles = counters_since(&start).cycles;
+    passed = true;
+    for (size_t i = 0; i < BF16_CONVERT_N; i++) {
+        if (h[i].bits != bf16_from_f32(f[i]).bits ||
+            (i < 8 && h[i].bits != edge_bf16[i]))
+            passed = false;
+    }
+    print_convert_result(passed, cycles);
+
+    /* Widening is exact, so narrowing again gives the same bf16; NaNs
+     * come back quiet */
+    TEST_LOGGER("  f32_from_bf16_array\n");
+    h[9].bits = 0xFF81;
+    counters_read(&start);
+    f32_from_bf16_array(f, h, BF16_CONVERT_N);
+    cycles = counters_since(&start).cycles;
+    passed = f[9].bits == 0xFFC10000;
+    for (size_t i = 0; i < BF16_CONVERT_N; i++) {
+        uint16_t back = bf16_from_f32(f[i]).bits;
+        if (f[i].bits != f32_from_bf16(h[i]).bits ||
+            (back != h[i].bits && back != (h[i].bits | 0x0040)))
+            passed = false;
+    }
+    print_convert_result(passed, cycles);
+}
+
+/* Counter samples as a random walk: mostly unchanged, often a small
+ * step either way, now and then a jump anywhere in range */
+static void uf8_stream_series(uint32_t *v, size_t n, uint32_t *state)
+{
+    uint32_t x = 1000;
+
+    for (size_t i = 0; i < n; i++) {
+        uint32_t r = bench_rand(state);
+        uint32_t k = r & 63, step = r >> 24;
+
+        if (k >= 62)
+            x = (r >> 8) % (UF8_MAX_VALUE + 1);
+        else if (k >= 51)
+            x = x > step ? x - step : 0;
+        else if (k >= 40)
+            x = x + step > UF8_MAX_VALUE ? UF8_MAX_VALUE : x + step;
+        v[i] = x;
+    }
+}
+
+#define UF8_STREAM_TEST_N 4096
+
+static uint32_t uf8_stream_v[UF8_STREAM_TEST_N];
+static uint8_t uf8_stream_code[2][UF8_STREAM_TEST_N];
+static uint8_t uf8_stream_buf[UF8_STREAM_BOUND(UF8_STREAM_TEST_N)];
+
+/* Stream round trip with every kind of chunk boundary: compressed in
+ * pieces of 1 to 97 codes, decoded from input pieces of 1 to 13 bytes
+ * into output space of 1 to 200 codes, so escapes and runs get split.
+ * A stretch longer than one run token is forced in. */
+static bool test_uf8_stream(void)
+{
+    uint32_t state = 0x3C6EF372;
+    uf8_stream_enc_t enc;
+    uf8_stream_dec_t dec;
+    size_t len = 0, pos = 0, out = 0, chunk, cap;
+
+    uf8_stream_series(uf8_stream_v, UF8_STREAM_TEST_N, &state);
+    for (size_t i = 0; i < UF8_STREAM_TEST_N; i++)
+        uf8_stream_code[0][i] = uf8_encoder(uf8_stream_v[i]);
+    for (size_t i = 1000; i < 1300; i++)
+        uf8_stream_code[0][i] = uf8_stream_code[0][999];
+
+    uf8_stream_enc_init(&enc);
+    chunk = 1;
+    for (size_t i = 0; i < UF8_STREAM_TEST_N; i += chunk) {
+        chunk = chunk % 97 + 1;
+        if (chunk > UF8_STREAM_TEST_N - i)
+            chunk = UF8_STREAM_TEST_N - i;
+        len += uf8_stream_compress(&enc, uf8_stream_code[0] + i, chunk,
+                                   uf8_stream_buf + len);
+    }
+    len += uf8_stream_finish(&enc, uf8_stream_buf + len);
+
+    uf8_stream_dec_init(&dec);
+    chunk = 1;
+    cap = 1;
+    for (;;) {
+        size_t used, n = len - pos < chunk ? len - pos : chunk;
+        size_t room = UF8_STREAM_TEST_N - out < cap ? UF8_STREAM_TEST_N - out
+                                                    : cap;
+        size_t got = uf8_stream_decompress(&dec, uf8_stream_buf + pos, n,
+                                           &used, uf8_stream_code[1] + out,
+                                           room);
+        if (!got && !used)
+            break;
+        pos += used;
+        out += got;
+        chunk = chunk % 13 + 1;
+        cap = cap % 200 + 1;
     }
 
-    /* Test infinity */
-    bf16_t inf = {.bits = 0x7F80};
-    TEST_LOGGER("  bf16_isinf(Inf): ");
-    if (bf16_isinf(inf)) {
-        TEST_LOGGER("PASSED\n");
-    } else {
-        TEST_LOGGER("FAILED\n");
+    if (pos != len || out != UF8_STREAM_TEST_N)
+        return false;
+    for (size_t i = 0; i < UF8_STREAM_TEST_N; i++) {
+        if (uf8_stream_code[0][i] != uf8_stream_code[1][i])
+            return false;
     }
+    return true;
 }
+
 static bool test_uf8(void)
 {
     int32_t previous_value = -1;
@@ -632,138 +2018,878 @@ static bool test_uf8(void)
         }
 
         previous_value = value;
+
+        if (uf8_decoder_lut(fl) != value || uf8_encoder_lut(value) != fl) {
+            TEST_LOGGER("Lookup table mismatch at ");
+            print_dec(fl);
+            passed = false;
+        }
+    }
+
+    if (!test_uf8_stream()) {
+        TEST_LOGGER("Stream round trip mismatch\n");
+        passed = false;
+    }
+
+    return passed;
+}
+
+/* Relative quantization error, |decoded - value| / value, in units of
+ * 2^-16; value 0 always decodes exactly */
+typedef struct {
+    uint32_t count;
+    uint32_t max;
+    uint64_t sum;
+} uf8_error_t;
+
+static uint32_t uf8_decoded[256];
+
+/* Accumulate the error of encode over every value in [lo, hi] */
+static void uf8_error_range(uf8_error_t *s,
+                            uint32_t lo,
+                            uint32_t hi,
+                            int (*encode)(int))
+{
+    for (uint32_t v = lo;; v++) {
+        uint32_t d = uf8_decoded[encode(v)];
+        uint32_t err = d > v ? d - v : v - d;
+
+        /* err < 2^15 for values in range, so err << 16 fits */
+        if (err)
+            err = (err << 16) / v;
+        if (err > s->max)
+            s->max = err;
+        s->sum += err;
+        s->count++;
+        if (v == hi)
+            break;
+    }
+}
+
+/* Mean error in 2^-16 units; the sum is halved together with the count
+ * until it fits the 32-bit divide */
+static uint32_t uf8_error_mean(const uf8_error_t *s)
+{
+    uint64_t sum = s->sum;
+    uint32_t count = s->count;
+
+    while (sum >> 32) {
+        sum >>= 1;
+        count >>= 1;
+    }
+    return count ? (uint32_t) sum / count : 0;
+}
+
+static void print_uf8_error(const uf8_error_t *s)
+{
+    TEST_LOGGER("    Mean relative error (%): ");
+    print_cpb(uf8_error_mean(s) * 100, 1 << 16);
+    TEST_LOGGER("    Max relative error (%): ");
+    print_cpb(s->max * 100, 1 << 16);
+}
+
+/* uf8_encoder_sat and uf8_encoder_round over every value 0..0xFFFFF,
+ * past UF8_MAX_VALUE included: saturation must give 0xFF there and
+ * uf8_encoder's code below it; rounding must land on a nearest code,
+ * the upper one on a tie */
+static bool test_uf8_modes(void)
+{
+    uf8_error_t truncated = {0}, rounded = {0};
+    bool passed = true;
+
+    for (int c = 0; c < 256; c++)
+        uf8_decoded[c] = uf8_decoder(c);
+
+    for (uint32_t v = 0; v <= 0xFFFFF; v++) {
+        uint32_t sat = uf8_encoder_sat(v);
+        uint32_t near = uf8_encoder_round(v);
+        uint32_t x = v > UF8_MAX_VALUE ? UF8_MAX_VALUE : v;
+
+        if (sat != (v > UF8_MAX_VALUE ? 0xFF : (uint32_t) uf8_encoder(v)))
+            passed = false;
+        if (near > 0xFF) {
+            passed = false;
+            continue;
+        }
+
+        uint32_t d = uf8_decoded[near];
+        if (x < d && (near == 0 || x - uf8_decoded[near - 1] < d - x))
+            passed = false;
+        if (x > d && (near == 0xFF || uf8_decoded[near + 1] - x <= x - d))
+            passed = false;
     }
 
+    uf8_error_range(&truncated, 0, 0xFFFFF, uf8_encoder_sat);
+    uf8_error_range(&rounded, 0, 0xFFFFF, uf8_encoder_round);
+
+    TEST_LOGGER("  Truncating, saturated:\n");
+    print_uf8_error(&truncated);
+    TEST_LOGGER("  Round to nearest, saturated:\n");
+    print_uf8_error(&rounded);
+
+    /* The worst case is the same tie for both, 17 between 16 and 18,
+     * but rounding must win on average */
+    if (rounded.max > truncated.max ||
+        uf8_error_mean(&rounded) >= uf8_error_mean(&truncated))
+        passed = false;
+
     return passed;
 }
 
+/* ============= Integer Runtime ============= */
+
+static const struct {
+    uint32_t a, b;
+    uint32_t lo, hi; /* a * b */
+    uint32_t q, r;   /* a / b, a % b */
+} mathrt_vectors[] = {
+    {0xFFFFFFFF, 0xFFFFFFFF, 0x00000001, 0xFFFFFFFE, 0x00000001, 0x00000000},
+    {0x12345678, 0x9ABCDEF0, 0x242D2080, 0x0B00EA4E, 0x00000000, 0x12345678},
+    {0x3B9ACA07, 0x3B800001, 0xDC1ACA07, 0x0DDA79F4, 0x00000001, 0x001ACA06},
+    {0x80000000, 0x00000002, 0x00000000, 0x00000001, 0x40000000, 0x00000000},
+    {0x075BCD15, 0x0000000A, 0x499602D2, 0x00000000, 0x00BC614E, 0x00000009},
+    {0x00000007, 0x00010000, 0x00070000, 0x00000000, 0x00000000, 0x00000007},
+    /* division by zero follows divu/remu */
+    {0xDEADBEEF, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFFFF, 0xDEADBEEF},
+};
+
+/* hi:lo as one 64-bit operand */
+static uint64_t mathrt_dword(uint32_t hi, uint32_t lo)
+{
+    return (uint64_t) hi << 32 | lo;
+}
+
+/* (a:b) * (b:a) mod 2^64 = a * b + ((a * a + b * b) << 32), from
+ * 32-bit products only */
+static uint64_t mathrt_muldi3_ref(uint32_t a, uint32_t b)
+{
+    uint64_t p = umul64(a, b);
+    uint32_t hi = (uint32_t) (p >> 32) + __mulsi3(a, a) + __mulsi3(b, b);
+    return mathrt_dword(hi, (uint32_t) p);
+}
+
+#define MATHRT_BENCH_OPS 256
+
+static uint32_t mathrt_bench_a[MATHRT_BENCH_OPS];
+static uint32_t mathrt_bench_b[MATHRT_BENCH_OPS];
+static uint32_t mathrt_bench_r[6][MATHRT_BENCH_OPS];
+static uint64_t mathrt_bench_d[MATHRT_BENCH_OPS];
+static uint64_t mathrt_bench_qr[MATHRT_BENCH_OPS];
+
+/* Full-width a against a b of exactly bits bits, which sets the trip
+ * count of the RV32I multiply and divide loops; the M build is flat */
+static bool bench_mathrt(unsigned bits)
+{
+    uint32_t state = 0x2545F491;
+    uint32_t top = 1U << (bits - 1);
+    counters_t start;
+    uint64_t cycles[7];
+
+    for (size_t i = 0; i < MATHRT_BENCH_OPS; i++) {
+        mathrt_bench_a[i] = bench_rand(&state);
+        mathrt_bench_b[i] = (bench_rand(&state) & (top - 1)) | top;
+    }
+
+    counters_read(&start);
+    for (size_t i = 0; i < MATHRT_BENCH_OPS; i++)
+        mathrt_bench_r[0][i] = __mulsi3(mathrt_bench_a[i], mathrt_bench_b[i]);
+    cycles[0] = counters_since(&start).cycles;
+
+    counters_read(&start);
+    for (size_t i = 0; i < MATHRT_BENCH_OPS; i++)
+        mathrt_bench_r[1][i] =
+            (uint32_t) (umul64(mathrt_bench_a[i], mathrt_bench_b[i]) >> 32);
+    cycles[1] = counters_since(&start).cycles;
+
+    counters_read(&start);
+    for (size_t i = 0; i < MATHRT_BENCH_OPS; i++)
+        mathrt_bench_r[2][i] = umulh32(mathrt_bench_a[i], mathrt_bench_b[i]);
+    cycles[2] = counters_since(&start).cycles;
+
+    counters_read(&start);
+    for (size_t i = 0; i < MATHRT_BENCH_OPS; i++)
+        mathrt_bench_d[i] = __muldi3(mathrt_dword(mathrt_bench_a[i],
+                                                  mathrt_bench_b[i]),
+                                     mathrt_dword(mathrt_bench_b[i],
+                                                  mathrt_bench_a[i]));
+    cycles[3] = counters_since(&start).cycles;
+
+    counters_read(&start);
+    for (size_t i = 0; i < MATHRT_BENCH_OPS; i++)
+        mathrt_bench_r[4][i] = __udivsi3(mathrt_bench_a[i], mathrt_bench_b[i]);
+    cycles[4] = counters_since(&start).cycles;
+
+    counters_read(&start);
+    for (size_t i = 0; i < MATHRT_BENCH_OPS; i++)
+        mathrt_bench_r[5][i] = __umodsi3(mathrt_bench_a[i], mathrt_bench_b[i]);
+    cycles[5] = counters_since(&start).cycles;
+
+    counters_read(&start);
+    for (size_t i = 0; i < MATHRT_BENCH_OPS; i++)
+        mathrt_bench_qr[i] = udivmod(mathrt_bench_a[i], mathrt_bench_b[i]);
+    cycles[6] = counters_since(&start).cycles;
+
+    TEST_LOGGER("    __mulsi3 cycles/op: ");
+    print_cpb(cycles[0], MATHRT_BENCH_OPS);
+    TEST_LOGGER("    umul64 cycles/op: ");
+    print_cpb(cycles[1], MATHRT_BENCH_OPS);
+    TEST_LOGGER("    umulh32 cycles/op: ");
+    print_cpb(cycles[2], MATHRT_BENCH_OPS);
+    TEST_LOGGER("    __muldi3 cycles/op: ");
+    print_cpb(cycles[3], MATHRT_BENCH_OPS);
+    TEST_LOGGER("    __udivsi3 cycles/op: ");
+    print_cpb(cycles[4], MATHRT_BENCH_OPS);
+    TEST_LOGGER("    __umodsi3 cycles/op: ");
+    print_cpb(cycles[5], MATHRT_BENCH_OPS);
+    TEST_LOGGER("    udivmod cycles/op: ");
+    print_cpb(cycles[6], MATHRT_BENCH_OPS);
+
+    /* q * b + r == a with r < b, and the multiplies agree with umul64 */
+    for (size_t i = 0; i < MATHRT_BENCH_OPS; i++) {
+        uint32_t a = mathrt_bench_a[i], b = mathrt_bench_b[i];
+        uint32_t q = mathrt_bench_r[4][i], r = mathrt_bench_r[5][i];
+        uint64_t p = umul64(q, b);
+        if ((uint32_t) p + r != a || p >> 32 || r >= b ||
+            mathrt_bench_qr[i] != mathrt_dword(r, q))
+            return false;
+        p = umul64(a, b);
+        if ((uint32_t) p != mathrt_bench_r[0][i] ||
+            (uint32_t) (p >> 32) != mathrt_bench_r[1][i] ||
+            (uint32_t) (p >> 32) != mathrt_bench_r[2][i] ||
+            mathrt_bench_d[i] != mathrt_muldi3_ref(a, b))
+            return false;
+    }
+    return true;
+}
+
+/* The digit loop print_dec had before udivmod10: a full division for
+ * the digit and another for the rest */
+static char *fmt_dec_div(char *end, unsigned long val)
+{
+    do {
+        *--end = '0' + __umodsi3(val, 10);
+        val = __udivsi3(val, 10);
+    } while (val > 0);
+    return end;
+}
+
+#define MATHRT_DEC_LEN 11
+
+static char mathrt_dec[2][MATHRT_BENCH_OPS][MATHRT_DEC_LEN];
+
+/* print_dec's formatting cost on values of up to ten digits, without the
+ * write ecall; every value is also checked against __udivsi3 by 10 */
+static void bench_print_dec(void)
+{
+    uint32_t state = 0x2545F491;
+    counters_t start;
+    uint64_t cycles[2];
+    bool passed = true;
+
+    for (size_t i = 0; i < MATHRT_BENCH_OPS; i++)
+        mathrt_bench_a[i] = bench_rand(&state) >> (i & 31);
+
+    counters_read(&start);
+    for (size_t i = 0; i < MATHRT_BENCH_OPS; i++)
+        fmt_dec_div(mathrt_dec[0][i] + MATHRT_DEC_LEN, mathrt_bench_a[i]);
+    cycles[0] = counters_since(&start).cycles;
+
+    counters_read(&start);
+    for (size_t i = 0; i < MATHRT_BENCH_OPS; i++)
+        fmt_dec(mathrt_dec[1][i] + MATHRT_DEC_LEN, mathrt_bench_a[i]);
+    cycles[1] = counters_since(&start).cycles;
+
+    TEST_LOGGER("  print_dec digits, __udivsi3 + __umodsi3 cycles/value: ");
+    print_cpb(cycles[0], MATHRT_BENCH_OPS);
+    TEST_LOGGER("  print_dec digits, udivmod10 cycles/value: ");
+    print_cpb(cycles[1], MATHRT_BENCH_OPS);
+
+    for (size_t i = 0; i < MATHRT_BENCH_OPS; i++) {
+        uint32_t a = mathrt_bench_a[i];
+        if (udivmod10(a) != mathrt_dword(a - __mulsi3(a / 10, 10), a / 10))
+            passed = false;
+        for (size_t j = 0; j < MATHRT_DEC_LEN; j++) {
+            if (mathrt_dec[0][i][j] != mathrt_dec[1][i][j])
+                passed = false;
+        }
+    }
+
+    if (passed) {
+        TEST_LOGGER("  Digit strings agree: PASSED\n");
+    } else {
+        TEST_LOGGER("  Digit strings agree: FAILED\n");
+    }
+
+    /* Around 2^32 and at the top of the range, then ratios whose
+     * remainder * 100 or numerator does not fit in 32 bits */
+    static const struct {
+        uint64_t val;
+        const char *dec;
+    } dec64[] = {
+        {0xFFFFFFFFULL, "4294967295"},
+        {0x100000000ULL, "4294967296"},
+        {10000000000000000000ULL, "10000000000000000000"},
+        {0xFFFFFFFFFFFFFFFFULL, "18446744073709551615"},
+    };
+    char buf[24];
+    char *end = buf + sizeof(buf) - 1;
+    *end = '\0';
+
+    passed = true;
+    for (size_t i = 0; i < sizeof(dec64) / sizeof(dec64[0]); i++) {
+        const char *p = fmt_dec64(end, dec64[i].val), *q = dec64[i].dec;
+        while (*p && *p == *q) {
+            p++;
+            q++;
+        }
+        if (*p || *q)
+            passed = false;
+    }
+    static const struct {
+        uint64_t num, den;
+        const char *dec;
+    } ratios[] = {
+        {100000000, 3, "33333333.33"},
+        {99999999, 50000000, "1.99"},
+        {0xFFFFFFFFULL, 0xFFFFFFFFULL, "1.00"},
+        {10000000000ULL, 3, "3333333333.33"},
+        {0xFFFFFFFFFFFFFFFULL, 0x100000000ULL, "268435455.99"},
+    };
+    for (size_t i = 0; i < sizeof(ratios) / sizeof(ratios[0]); i++) {
+        const char *p = fmt_ratio(end, ratios[i].num, ratios[i].den),
+                   *q = ratios[i].dec;
+        while (*p && *p == *q) {
+            p++;
+            q++;
+        }
+        if (*p || *q)
+            passed = false;
+    }
+
+    if (passed) {
+        TEST_LOGGER("  64-bit and long-ratio formatting: PASSED\n");
+    } else {
+        TEST_LOGGER("  64-bit and long-ratio formatting: FAILED\n");
+    }
+}
+
+static void test_mathrt(void)
+{
+    TEST_LOGGER("Test: integer runtime\n");
+
+    if (mathrt_m) {
+        TEST_LOGGER("  Runtime: M extension mul/mulhu/divu/remu\n");
+    } else {
+        TEST_LOGGER("  Runtime: RV32I software\n");
+    }
+
+    bool passed = true;
+    for (size_t i = 0; i < sizeof(mathrt_vectors) / sizeof(mathrt_vectors[0]);
+         i++) {
+        uint32_t a = mathrt_vectors[i].a, b = mathrt_vectors[i].b;
+        uint64_t p = umul64(a, b);
+        if (__mulsi3(a, b) != mathrt_vectors[i].lo ||
+            (uint32_t) p != mathrt_vectors[i].lo ||
+            (uint32_t) (p >> 32) != mathrt_vectors[i].hi ||
+            umulh32(a, b) != mathrt_vectors[i].hi ||
+            __muldi3(mathrt_dword(a, b), mathrt_dword(b, a)) !=
+                mathrt_muldi3_ref(a, b) ||
+            __udivsi3(a, b) != mathrt_vectors[i].q ||
+            __umodsi3(a, b) != mathrt_vectors[i].r ||
+            udivmod(a, b) !=
+                mathrt_dword(mathrt_vectors[i].r, mathrt_vectors[i].q))
+            passed = false;
+    }
+
+    if (passed) {
+        TEST_LOGGER("  Known products and quotients: PASSED\n");
+    } else {
+        TEST_LOGGER("  Known products and quotients: FAILED\n");
+    }
+
+    passed = true;
+    TEST_LOGGER("  8-bit b:\n");
+    passed &= bench_mathrt(8);
+    TEST_LOGGER("  16-bit b:\n");
+    passed &= bench_mathrt(16);
+    TEST_LOGGER("  32-bit b:\n");
+    passed &= bench_mathrt(32);
+
+    if (passed) {
+        TEST_LOGGER("  Quotient and remainder identities: PASSED\n");
+    } else {
+        TEST_LOGGER("  Quotient and remainder identities: FAILED\n");
+    }
+
+    bench_print_dec();
+}
+
+#define UF8_BENCH_N 1024
+
+static uint32_t uf8_bench_v[UF8_BENCH_N];
+static uint8_t uf8_bench_code[2][UF8_BENCH_N];
+
+/* The loop encoder problem_b.s used to have against the closed form, on
+ * random values up to the largest one uf8 represents */
+static void bench_uf8_encoder(void)
+{
+    uint32_t state = 0x2545F491;
+    counters_t start;
+    uint64_t cycles[2];
+
+    for (size_t i = 0; i < UF8_BENCH_N; i++)
+        uf8_bench_v[i] = (bench_rand(&state) >> 12) % (UF8_MAX_VALUE + 1);
+
+    counters_read(&start);
+    for (size_t i = 0; i < UF8_BENCH_N; i++)
+        uf8_bench_code[0][i] = uf8_encoder_loop(uf8_bench_v[i]);
+    cycles[0] = counters_since(&start).cycles;
+
+    counters_read(&start);
+    for (size_t i = 0; i < UF8_BENCH_N; i++)
+        uf8_bench_code[1][i] = uf8_encoder(uf8_bench_v[i]);
+    cycles[1] = counters_since(&start).cycles;
+
+    TEST_LOGGER("  Loop encoder cycles/value: ");
+    print_cpb(cycles[0], UF8_BENCH_N);
+    TEST_LOGGER("  Closed-form encoder cycles/value: ");
+    print_cpb(cycles[1], UF8_BENCH_N);
+
+    bool passed = true;
+    for (size_t i = 0; i < UF8_BENCH_N; i++) {
+        if (uf8_bench_code[0][i] != uf8_bench_code[1][i])
+            passed = false;
+    }
+
+    if (passed) {
+        TEST_LOGGER("  Encoders agree: PASSED\n");
+    } else {
+        TEST_LOGGER("  Encoders agree: FAILED\n");
+    }
+}
+
+#define UF8_ARRAY_N 65536
+
+static uint32_t uf8_array_v[UF8_ARRAY_N];
+static uint32_t uf8_array_dec[UF8_ARRAY_N];
+static uint8_t uf8_array_code[2][UF8_ARRAY_N + 4];
+
+/* uf8_encode_array/uf8_decode_array against a loop over the scalar
+ * routines, then once more with the buffers off word alignment so the
+ * byte head and tail run too */
+static void bench_uf8_arrays(void)
+{
+    uint32_t state = 0x9E3779B9;
+    counters_t start;
+    uint64_t cycles[4];
+    bool passed = true;
+
+    for (size_t i = 0; i < UF8_ARRAY_N; i++)
+        uf8_array_v[i] = (bench_rand(&state) >> 12) % (UF8_MAX_VALUE + 1);
+
+    TEST_LOGGER("Benchmark: uf8 array codec\n");
+    TEST_LOGGER("  Elements: ");
+    print_dec(UF8_ARRAY_N);
+
+    counters_read(&start);
+    for (size_t i = 0; i < UF8_ARRAY_N; i++)
+        uf8_array_code[0][i] = uf8_encoder(uf8_array_v[i]);
+    cycles[0] = counters_since(&start).cycles;
+
+    counters_read(&start);
+    uf8_encode_array(uf8_array_v, uf8_array_code[1], UF8_ARRAY_N);
+    cycles[1] = counters_since(&start).cycles;
+
+    for (size_t i = 0; i < UF8_ARRAY_N; i++) {
+        if (uf8_array_code[0][i] != uf8_array_code[1][i])
+            passed = false;
+    }
+
+    counters_read(&start);
+    for (size_t i = 0; i < UF8_ARRAY_N; i++)
+        uf8_array_dec[i] = uf8_decoder(uf8_array_code[1][i]);
+    cycles[2] = counters_since(&start).cycles;
+
+    counters_read(&start);
+    uf8_decode_array(uf8_array_code[1], uf8_array_v, UF8_ARRAY_N);
+    cycles[3] = counters_since(&start).cycles;
+
+    for (size_t i = 0; i < UF8_ARRAY_N; i++) {
+        if (uf8_array_v[i] != uf8_array_dec[i])
+            passed = false;
+    }
+
+    TEST_LOGGER("  uf8_encoder loop cycles/element: ");
+    print_cpb(cycles[0], UF8_ARRAY_N);
+    TEST_LOGGER("  uf8_encode_array cycles/element: ");
+    print_cpb(cycles[1], UF8_ARRAY_N);
+    TEST_LOGGER("  uf8_decoder loop cycles/element: ");
+    print_cpb(cycles[2], UF8_ARRAY_N);
+    TEST_LOGGER("  uf8_decode_array cycles/element: ");
+    print_cpb(cycles[3], UF8_ARRAY_N);
+
+    /* decoded values re-encode to the same codes, here from in + 1 into
+     * out + 1 with a length that leaves a tail */
+    uf8_encode_array(uf8_array_v + 1, uf8_array_code[0] + 1, 1021);
+    for (size_t i = 1; i <= 1021; i++) {
+        if (uf8_array_code[0][i] != uf8_array_code[1][i])
+            passed = false;
+    }
+    uf8_decode_array(uf8_array_code[1] + 3, uf8_array_dec, 1022);
+    for (size_t i = 0; i < 1022; i++) {
+        if (uf8_array_dec[i] != uf8_array_v[i + 3])
+            passed = false;
+    }
+
+    if (passed) {
+        TEST_LOGGER("  Array and scalar codecs agree: PASSED\n");
+    } else {
+        TEST_LOGGER("  Array and scalar codecs agree: FAILED\n");
+    }
+}
+
+static uint8_t uf8_lut_in[UF8_BENCH_N];
+static uint8_t uf8_lut_code[2][UF8_BENCH_N];
+static uint32_t uf8_lut_value[2][UF8_BENCH_N];
+
+/* uf8_decoder/uf8_encoder against the table-driven variants, on random
+ * input and on a sequential sweep: codes in order for the decoders, an
+ * evenly spaced ramp over 0..UF8_MAX_VALUE for the encoders */
+static void bench_uf8_lut(void)
+{
+    uint32_t state = 0x6A09E667;
+    counters_t start;
+    uint64_t cycles[4];
+    bool passed = true;
+
+    TEST_LOGGER("Benchmark: uf8 arithmetic vs lookup table\n");
+    for (int sequential = 0; sequential < 2; sequential++) {
+        for (size_t i = 0; i < UF8_BENCH_N; i++) {
+            if (sequential) {
+                uf8_lut_in[i] = i;
+                uf8_bench_v[i] = i * (UF8_MAX_VALUE / UF8_BENCH_N);
+            } else {
+                uf8_lut_in[i] = bench_rand(&state) >> 24;
+                uf8_bench_v[i] =
+                    (bench_rand(&state) >> 12) % (UF8_MAX_VALUE + 1);
+            }
+        }
+
+        counters_read(&start);
+        for (size_t i = 0; i < UF8_BENCH_N; i++)
+            uf8_lut_value[0][i] = uf8_decoder(uf8_lut_in[i]);
+        cycles[0] = counters_since(&start).cycles;
+
+        counters_read(&start);
+        for (size_t i = 0; i < UF8_BENCH_N; i++)
+            uf8_lut_value[1][i] = uf8_decoder_lut(uf8_lut_in[i]);
+        cycles[1] = counters_since(&start).cycles;
+
+        counters_read(&start);
+        for (size_t i = 0; i < UF8_BENCH_N; i++)
+            uf8_lut_code[0][i] = uf8_encoder(uf8_bench_v[i]);
+        cycles[2] = counters_since(&start).cycles;
+
+        counters_read(&start);
+        for (size_t i = 0; i < UF8_BENCH_N; i++)
+            uf8_lut_code[1][i] = uf8_encoder_lut(uf8_bench_v[i]);
+        cycles[3] = counters_since(&start).cycles;
+
+        for (size_t i = 0; i < UF8_BENCH_N; i++) {
+            if (uf8_lut_value[0][i] != uf8_lut_value[1][i] ||
+                uf8_lut_code[0][i] != uf8_lut_code[1][i])
+                passed = false;
+        }
+
+        if (sequential) {
+            TEST_LOGGER("  Sequential input:\n");
+        } else {
+            TEST_LOGGER("  Random input:\n");
+        }
+        TEST_LOGGER("    uf8_decoder cycles/op: ");
+        print_cpb(cycles[0], UF8_BENCH_N);
+        TEST_LOGGER("    uf8_decoder_lut cycles/op: ");
+        print_cpb(cycles[1], UF8_BENCH_N);
+        if (cycles[1] < cycles[0]) {
+            TEST_LOGGER("    Faster decoder: lookup table\n");
+        } else {
+            TEST_LOGGER("    Faster decoder: arithmetic\n");
+        }
+        TEST_LOGGER("    uf8_encoder cycles/op: ");
+        print_cpb(cycles[2], UF8_BENCH_N);
+        TEST_LOGGER("    uf8_encoder_lut cycles/op: ");
+        print_cpb(cycles[3], UF8_BENCH_N);
+        if (cycles[3] < cycles[2]) {
+            TEST_LOGGER("    Faster encoder: lookup table\n");
+        } else {
+            TEST_LOGGER("    Faster encoder: arithmetic\n");
+        }
+    }
+
+    if (passed) {
+        TEST_LOGGER("  Variants agree: PASSED\n");
+    } else {
+        TEST_LOGGER("  Variants agree: FAILED\n");
+    }
+}
+
+static uint8_t uf8_stream_big[UF8_STREAM_BOUND(UF8_ARRAY_N)];
+
+/* Delta + run-length stream over 64K samples of the uf8_stream_series
+ * walk, each direction in a single call */
+static void bench_uf8_stream(void)
+{
+    uint32_t state = 0xBB67AE85;
+    counters_t start;
+    uint64_t cycles[2];
+    uf8_stream_enc_t enc;
+    uf8_stream_dec_t dec;
+    size_t len, used, out;
+
+    uf8_stream_series(uf8_array_v, UF8_ARRAY_N, &state);
+    uf8_encode_array(uf8_array_v, uf8_array_code[0], UF8_ARRAY_N);
+
+    counters_read(&start);
+    uf8_stream_enc_init(&enc);
+    len = uf8_stream_compress(&enc, uf8_array_code[0], UF8_ARRAY_N,
+                              uf8_stream_big);
+    len += uf8_stream_finish(&enc, uf8_stream_big + len);
+    cycles[0] = counters_since(&start).cycles;
+
+    counters_read(&start);
+    uf8_stream_dec_init(&dec);
+    out = uf8_stream_decompress(&dec, uf8_stream_big, len, &used,
+                                uf8_array_code[1], UF8_ARRAY_N);
+    cycles[1] = counters_since(&start).cycles;
+
+    TEST_LOGGER("Benchmark: uf8 delta + run-length stream\n");
+    TEST_LOGGER("  Samples: ");
+    print_dec(UF8_ARRAY_N);
+    TEST_LOGGER("  Compressed bytes: ");
+    print_dec(len);
+    TEST_LOGGER("  Compression ratio: ");
+    print_cpb(UF8_ARRAY_N, len);
+    TEST_LOGGER("  Compress cycles/sample: ");
+    print_cpb(cycles[0], UF8_ARRAY_N);
+    TEST_LOGGER("  Decompress cycles/sample: ");
+    print_cpb(cycles[1], UF8_ARRAY_N);
+
+    bool passed = out == UF8_ARRAY_N && used == len;
+    for (size_t i = 0; passed && i < UF8_ARRAY_N; i++) {
+        if (uf8_array_code[0][i] != uf8_array_code[1][i])
+            passed = false;
+    }
+
+    if (passed) {
+        TEST_LOGGER("  Lossless round trip: PASSED\n");
+    } else {
+        TEST_LOGGER("  Lossless round trip: FAILED\n");
+    }
+}
+
+#ifdef CHACHA20_BENCH
+/* make bench: only the throughput table, no tests */
+int main(void)
+{
+    counters_calibrate();
+    TEST_LOGGER("\n=== ChaCha20 Benchmark ===\n\n");
+
+    bench_chacha20_sweep();
+
+    TEST_LOGGER("\n=== Benchmark Completed ===\n");
+    console_flush();
+
+    return 0;
+}
+#elif defined(UF8_BENCH)
+/* make bench-uf8: only the uf8 codec benchmarks, no tests */
+int main(void)
+{
+    counters_calibrate();
+    TEST_LOGGER("\n=== UF8 Benchmark ===\n\n");
+
+    bench_uf8_encoder();
+    bench_uf8_arrays();
+    bench_uf8_lut();
+    bench_uf8_stream();
+
+    TEST_LOGGER("\n=== Benchmark Completed ===\n");
+    console_flush();
+
+    return 0;
+}
+#else
 int main(void)
 {
-    uint64_t start_cycles, end_cycles, cycles_elapsed;
-    uint64_t start_instret, end_instret, instret_elapsed;
+    counters_t start, elapsed;
+
+    counters_calibrate();
+    TEST_LOGGER("\nCounter overhead subtracted, cycles: ");
+    print_dec64(counter_overhead.cycles);
+    TEST_LOGGER("Counter overhead subtracted, instructions: ");
+    print_dec64(counter_overhead.instret);
 
     TEST_LOGGER("\n=== ChaCha20 Tests ===\n\n");
 
     /* Test 0: ChaCha20 */
     TEST_LOGGER("Test 0: ChaCha20 (RISC-V Assembly)\n");
-    start_cycles = get_cycles();
-    start_instret = get_instret();
+    counters_read(&start);
 
     test_chacha20();
+    test_chacha20_poly1305();
 
-    end_cycles = get_cycles();
-    end_instret = get_instret();
-    cycles_elapsed = end_cycles - start_cycles;
-    instret_elapsed = end_instret - start_instret;
+    elapsed = counters_since(&start);
 
     TEST_LOGGER("  Cycles: ");
-    print_dec((unsigned long) cycles_elapsed);
+    print_dec64(elapsed.cycles);
     TEST_LOGGER("  Instructions: ");
-    print_dec((unsigned long) instret_elapsed);
+    print_dec64(elapsed.instret);
     TEST_LOGGER("\n");
 
+    bench_chacha20();
+    bench_chacha20_cache();
+
     TEST_LOGGER("\n=== BFloat16 Tests ===\n\n");
+#if BF16_ROUND_NEAREST
+    TEST_LOGGER("Rounding: nearest even\n\n");
+#else
+    TEST_LOGGER("Rounding: truncate\n\n");
+#endif
 
     /* Test 1: Addition */
     TEST_LOGGER("Test 1: bf16_add\n");
-    start_cycles = get_cycles();
-    start_instret = get_instret();
+    counters_read(&start);
 
     test_bf16_add();
 
-    end_cycles = get_cycles();
-    end_instret = get_instret();
-    cycles_elapsed = end_cycles - start_cycles;
-    instret_elapsed = end_instret - start_instret;
+    elapsed = counters_since(&start);
 
     TEST_LOGGER("  Cycles: ");
-    print_dec((unsigned long) cycles_elapsed);
+    print_dec64(elapsed.cycles);
     TEST_LOGGER("  Instructions: ");
-    print_dec((unsigned long) instret_elapsed);
+    print_dec64(elapsed.instret);
     TEST_LOGGER("\n");
 
     /* Test 2: Subtraction */
     TEST_LOGGER("Test 2: bf16_sub\n");
-    start_cycles = get_cycles();
-    start_instret = get_instret();
+    counters_read(&start);
 
     test_bf16_sub();
 
-    end_cycles = get_cycles();
-    end_instret = get_instret();
-    cycles_elapsed = end_cycles - start_cycles;
-    instret_elapsed = end_instret - start_instret;
+    elapsed = counters_since(&start);
 
     TEST_LOGGER("  Cycles: ");
-    print_dec((unsigned long) cycles_elapsed);
+    print_dec64(elapsed.cycles);
     TEST_LOGGER("  Instructions: ");
-    print_dec((unsigned long) instret_elapsed);
+    print_dec64(elapsed.instret);
     TEST_LOGGER("\n");
 
     /* Test 3: Multiplication */
     TEST_LOGGER("Test 3: bf16_mul\n");
-    start_cycles = get_cycles();
-    start_instret = get_instret();
+    counters_read(&start);
 
     test_bf16_mul();
 
-    end_cycles = get_cycles();
-    end_instret = get_instret();
-    cycles_elapsed = end_cycles - start_cycles;
-    instret_elapsed = end_instret - start_instret;
+    elapsed = counters_since(&start);
 
     TEST_LOGGER("  Cycles: ");
-    print_dec((unsigned long) cycles_elapsed);
+    print_dec64(elapsed.cycles);
     TEST_LOGGER("  Instructions: ");
-    print_dec((unsigned long) instret_elapsed);
+    print_dec64(elapsed.instret);
     TEST_LOGGER("\n");
 
     /* Test 4: Division */
     TEST_LOGGER("Test 4: bf16_div\n");
-    start_cycles = get_cycles();
-    start_instret = get_instret();
+    counters_read(&start);
 
     test_bf16_div();
 
-    end_cycles = get_cycles();
-    end_instret = get_instret();
-    cycles_elapsed = end_cycles - start_cycles;
-    instret_elapsed = end_instret - start_instret;
+    elapsed = counters_since(&start);
 
     TEST_LOGGER("  Cycles: ");
-    print_dec((unsigned long) cycles_elapsed);
+    print_dec64(elapsed.cycles);
     TEST_LOGGER("  Instructions: ");
-    print_dec((unsigned long) instret_elapsed);
+    print_dec64(elapsed.instret);
     TEST_LOGGER("\n");
 
     /* Test 5: Special cases */
     TEST_LOGGER("Test 5: bf16_special_cases\n");
-    start_cycles = get_cycles();
-    start_instret = get_instret();
+    counters_read(&start);
 
     test_bf16_special_cases();
 
-    end_cycles = get_cycles();
-    end_instret = get_instret();
-    cycles_elapsed = end_cycles - start_cycles;
-    instret_elapsed = end_instret - start_instret;
+    elapsed = counters_since(&start);
+
+    TEST_LOGGER("  Cycles: ");
+    print_dec64(elapsed.cycles);
+    TEST_LOGGER("  Instructions: ");
+    print_dec64(elapsed.instret);
+    TEST_LOGGER("\n");
+
+    /* Test 6: Array kernels */
+    TEST_LOGGER("Test 6: bf16 array kernels\n");
+    counters_read(&start);
+
+    test_bf16_arrays();
+
+    elapsed = counters_since(&start);
+
+    TEST_LOGGER("  Cycles: ");
+    print_dec64(elapsed.cycles);
+    TEST_LOGGER("  Instructions: ");
+    print_dec64(elapsed.instret);
+    TEST_LOGGER("\n");
+
+    /* Test 7: Fused multiply-add */
+    TEST_LOGGER("Test 7: bf16_fma\n");
+    counters_read(&start);
+
+    test_bf16_fma();
+
+    elapsed = counters_since(&start);
+
+    TEST_LOGGER("  Cycles: ");
+    print_dec64(elapsed.cycles);
+    TEST_LOGGER("  Instructions: ");
+    print_dec64(elapsed.instret);
+    TEST_LOGGER("\n");
+
+    /* Test 8: fp32 conversion */
+    TEST_LOGGER("Test 8: bf16 <-> fp32 conversion\n");
+    counters_read(&start);
+
+    test_bf16_convert();
+
+    elapsed = counters_since(&start);
 
     TEST_LOGGER("  Cycles: ");
-    print_dec((unsigned long) cycles_elapsed);
+    print_dec64(elapsed.cycles);
     TEST_LOGGER("  Instructions: ");
-    print_dec((unsigned long) instret_elapsed);
+    print_dec64(elapsed.instret);
     
+    TEST_LOGGER("\n=== Integer Runtime Tests ===\n\n");
+
+    /* Test 9: Integer runtime */
+    TEST_LOGGER("Test 9: mathrt\n");
+    counters_read(&start);
+
+    test_mathrt();
+
+    elapsed = counters_since(&start);
+
+    TEST_LOGGER("  Cycles: ");
+    print_dec64(elapsed.cycles);
+    TEST_LOGGER("  Instructions: ");
+    print_dec64(elapsed.instret);
+    TEST_LOGGER("\n");
+
     TEST_LOGGER("\n=== UF8 Encode/Decode Test ===\n\n");
 
-    start_cycles = get_cycles();
-    start_instret = get_instret();
+    counters_read(&start);
 
     bool ok = test_uf8();
 
-    end_cycles = get_cycles();
-    end_instret = get_instret();
-    cycles_elapsed = end_cycles - start_cycles;
-    instret_elapsed = end_instret - start_instret;
+    elapsed = counters_since(&start);
 
     if (ok){
         TEST_LOGGER("  UF8 encode/decode test: PASSED\n");}
@@ -771,13 +2897,34 @@ int main(void)
         TEST_LOGGER("  UF8 encode/decode test: FAILED\n");
     }
     TEST_LOGGER("  Cycles: ");
-    print_dec((unsigned long)cycles_elapsed);
+    print_dec64(elapsed.cycles);
+    TEST_LOGGER("  Instructions: ");
+    print_dec64(elapsed.instret);
+    TEST_LOGGER("\n");
+
+    TEST_LOGGER("Test: uf8 saturating and rounding encoders\n");
+    counters_read(&start);
+    ok = test_uf8_modes();
+    elapsed = counters_since(&start);
+    if (ok) {
+        TEST_LOGGER("  Encode modes over 0..0xFFFFF: PASSED\n");
+    } else {
+        TEST_LOGGER("  Encode modes over 0..0xFFFFF: FAILED\n");
+    }
+    TEST_LOGGER("  Cycles: ");
+    print_dec64(elapsed.cycles);
     TEST_LOGGER("  Instructions: ");
-    print_dec((unsigned long)instret_elapsed);
+    print_dec64(elapsed.instret);
     TEST_LOGGER("\n");
 
+    bench_uf8_encoder();
+    bench_uf8_arrays();
+    bench_uf8_lut();
+    bench_uf8_stream();
 
     TEST_LOGGER("\n=== All Tests Completed ===\n");
+    console_flush();
 
     return 0;
 }
+#endif
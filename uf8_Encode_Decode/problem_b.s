@@ -2,6 +2,13 @@
 .text 
 .global uf8_decoder 
 .global uf8_encoder 
+.global uf8_encoder_loop
+.global uf8_encode_array
+.global uf8_decode_array
+.global uf8_decoder_lut
+.global uf8_encoder_lut
+.global uf8_encoder_sat
+.global uf8_encoder_round
 
 .type clz, @function
 clz:
@@ -35,8 +42,57 @@ uf8_decoder:
     sll t4,t0,t1 #mantissa << exponent
     add a0,t4,t3
     ret
+# Closed form of the loops below: value + 16 lies in [16 << e, 32 << e)
+# for the exponent e whose offset (2^e - 1) * 16 the decoder adds back,
+# so e = 27 - clz(value + 16), capped at 15, and the mantissa is
+# ((value + 16) >> e) - 16. No loops, no calls, no stack.
 .type uf8_encoder, @function
 uf8_encoder:
+    addi t0,a0,16 #x = value + 16
+.ifdef HAVE_ZBB
+    clz t1,t0
+.else
+    li t1,0 #clz(x), branch-free binary search
+    srli t2,t0,16
+    seqz t2,t2
+    slli t2,t2,4
+    sll t0,t0,t2
+    add t1,t1,t2
+    srli t2,t0,24
+    seqz t2,t2
+    slli t2,t2,3
+    sll t0,t0,t2
+    add t1,t1,t2
+    srli t2,t0,28
+    seqz t2,t2
+    slli t2,t2,2
+    sll t0,t0,t2
+    add t1,t1,t2
+    srli t2,t0,30
+    seqz t2,t2
+    slli t2,t2,1
+    sll t0,t0,t2
+    add t1,t1,t2
+    srli t2,t0,31
+    seqz t2,t2
+    add t1,t1,t2
+    addi t0,a0,16
+.endif
+    li t2,27
+    sub t1,t2,t1 #exponent = 27 - clz
+    addi t2,t1,-15
+    srai t3,t2,31
+    and t2,t2,t3
+    addi t1,t2,15 #exponent = min(exponent, 15)
+    srl t0,t0,t1
+    addi t0,t0,-16 #mantissa
+    slli a0,t1,4
+    or a0,a0,t0
+    ret
+
+# Loop version uf8_encoder replaced, kept for the cycle comparison
+.type uf8_encoder_loop, @function
+uf8_encoder_loop:
     addi sp, sp, -20       
     sw  ra, 16(sp)     
     sw  s0, 12(sp) 
@@ -48,9 +104,9 @@ uf8_encoder:
     bnez t0,clz_encoder_if1_loop 
     #if (value < 16) return value;
     jal ra,clz #lz
-    mv s9,a0 # t1=lz 
+    mv t1,a0 # t1=lz
     li t0,31
-    sub s3,t0,s9 # s3=msb
+    sub s3,t0,t1 # s3=msb
     li s1,0 #exponent
     li s2,0 #overflow
     li t0,5
@@ -104,3 +160,287 @@ encoder_end:
     lw  ra,16(sp)        
     addi sp, sp, 20   
     ret
+
+# r = uf8 code of v as one byte, the uf8_encoder closed form; v is kept
+.macro uf8_enc r, v, t1, t2
+.ifdef HAVE_ZBB
+    addi \t1, \v, 16
+    clz \t2, \t1
+    li \r, 27
+    sub \r, \r, \t2
+.else
+    addi \t1, \v, 16 #exponent = msb(value + 16) - 4, binary search
+    li \r, -4
+    srli \t2, \t1, 16
+    snez \t2, \t2
+    slli \t2, \t2, 4
+    srl \t1, \t1, \t2
+    add \r, \r, \t2
+    srli \t2, \t1, 8
+    snez \t2, \t2
+    slli \t2, \t2, 3
+    srl \t1, \t1, \t2
+    add \r, \r, \t2
+    srli \t2, \t1, 4
+    snez \t2, \t2
+    slli \t2, \t2, 2
+    srl \t1, \t1, \t2
+    add \r, \r, \t2
+    srli \t2, \t1, 2
+    snez \t2, \t2
+    slli \t2, \t2, 1
+    srl \t1, \t1, \t2
+    add \r, \r, \t2
+    srli \t2, \t1, 1
+    add \r, \r, \t2
+.endif
+    addi \t2, \r, -15
+    srai \t1, \t2, 31
+    and \t2, \t2, \t1
+    addi \r, \t2, 15 #exponent = min(exponent, 15)
+    addi \t1, \v, 16
+    srl \t1, \t1, \r
+    addi \t1, \t1, -16 #mantissa
+    slli \r, \r, 4
+    or \r, \r, \t1
+    andi \r, \r, 0xFF
+.endm
+
+# r = value of the code in bits sh..sh+7 of w: ((m | 16) << e) - 16 is
+# the decoder's (m << e) + ((0x7FFF >> (15 - e)) << 4) in one shift
+.macro uf8_dec r, w, sh, t
+    srli \t, \w, \sh + 4
+    andi \t, \t, 15 #exponent
+    srli \r, \w, \sh
+    andi \r, \r, 15 #mantissa
+    ori \r, \r, 16
+    sll \r, \r, \t
+    addi \r, \r, -16
+.endm
+
+# void uf8_encode_array(const uint32_t *in, uint8_t *out, size_t n)
+#
+# Bytes one at a time until out is word aligned, then four values per
+# iteration packed into a single store; out[i] is (uint8_t)
+# uf8_encoder(in[i]). Leaf code, temporaries only.
+.type uf8_encode_array, @function
+uf8_encode_array:
+encode_array_head:
+    beqz a2, encode_array_end
+    andi t0, a1, 3
+    beqz t0, encode_array_words
+    lw a3, 0(a0)
+    uf8_enc a4, a3, t0, t1
+    sb a4, 0(a1)
+    addi a0, a0, 4
+    addi a1, a1, 1
+    addi a2, a2, -1
+    j encode_array_head
+encode_array_words:
+    li t6, 4
+encode_array_loop:
+    bltu a2, t6, encode_array_tail
+    lw a3, 0(a0)
+    lw a4, 4(a0)
+    lw a5, 8(a0)
+    lw a6, 12(a0)
+    uf8_enc t2, a3, t0, t1
+    uf8_enc t3, a4, t0, t1
+    uf8_enc t4, a5, t0, t1
+    uf8_enc t5, a6, t0, t1
+    slli t3, t3, 8
+    slli t4, t4, 16
+    slli t5, t5, 24
+    or t2, t2, t3
+    or t4, t4, t5
+    or t2, t2, t4
+    sw t2, 0(a1)
+    addi a0, a0, 16
+    addi a1, a1, 4
+    addi a2, a2, -4
+    j encode_array_loop
+encode_array_tail:
+    beqz a2, encode_array_end
+    lw a3, 0(a0)
+    uf8_enc a4, a3, t0, t1
+    sb a4, 0(a1)
+    addi a0, a0, 4
+    addi a1, a1, 1
+    addi a2, a2, -1
+    j encode_array_tail
+encode_array_end:
+    ret
+
+# void uf8_decode_array(const uint8_t *in, uint32_t *out, size_t n)
+#
+# Codes one at a time until in is word aligned, then one load for four
+# codes per iteration. Leaf code, temporaries only.
+.type uf8_decode_array, @function
+uf8_decode_array:
+decode_array_head:
+    beqz a2, decode_array_end
+    andi t0, a0, 3
+    beqz t0, decode_array_words
+    lbu a3, 0(a0)
+    uf8_dec a4, a3, 0, t0
+    sw a4, 0(a1)
+    addi a0, a0, 1
+    addi a1, a1, 4
+    addi a2, a2, -1
+    j decode_array_head
+decode_array_words:
+    li t6, 4
+decode_array_loop:
+    bltu a2, t6, decode_array_tail
+    lw a3, 0(a0)
+    uf8_dec t1, a3, 0, t0
+    uf8_dec t2, a3, 8, t0
+    uf8_dec t3, a3, 16, t0
+    uf8_dec t4, a3, 24, t0
+    sw t1, 0(a1)
+    sw t2, 4(a1)
+    sw t3, 8(a1)
+    sw t4, 12(a1)
+    addi a0, a0, 4
+    addi a1, a1, 16
+    addi a2, a2, -4
+    j decode_array_loop
+decode_array_tail:
+    beqz a2, decode_array_end
+    lbu a3, 0(a0)
+    uf8_dec a4, a3, 0, t0
+    sw a4, 0(a1)
+    addi a0, a0, 1
+    addi a1, a1, 4
+    addi a2, a2, -1
+    j decode_array_tail
+decode_array_end:
+    ret
+
+.data
+
+# value of every code, ((m | 16) << e) - 16
+.align 2
+uf8_decode_lut:
+.set uf8_code, 0
+.rept 256
+    .word (((uf8_code & 15) | 16) << (uf8_code >> 4)) - 16
+.set uf8_code, uf8_code + 1
+.endr
+
+.ifdef HAVE_ZBB
+# exponent by clz(value + 16): 27 - clz capped at 15; clz above 27 only
+# comes from value + 16 wrapping
+uf8_clz_exponent:
+.set uf8_clz, 0
+.rept 32
+.if uf8_clz < 13
+    .byte 15
+.elseif uf8_clz < 28
+    .byte 27 - uf8_clz
+.else
+    .byte 0
+.endif
+.set uf8_clz, uf8_clz + 1
+.endr
+.else
+# smallest value of each exponent, (2^e - 1) * 16
+.align 2
+uf8_offset_lut:
+.set uf8_exp, 0
+.rept 16
+    .word ((1 << uf8_exp) - 1) * 16
+.set uf8_exp, uf8_exp + 1
+.endr
+.endif
+
+.text
+
+# Table-driven uf8_decoder: one load from the 256-word table
+.type uf8_decoder_lut, @function
+uf8_decoder_lut:
+    andi a0,a0,0xFF
+    slli a0,a0,2
+    la t0,uf8_decode_lut
+    add t0,t0,a0
+    lw a0,0(t0)
+    ret
+
+# Table-driven uf8_encoder, same results. The exponent comes from the
+# clz-indexed table with Zbb, otherwise from a four-step branch-free
+# search of the offset table that walks a pointer to &offset[e].
+.type uf8_encoder_lut, @function
+uf8_encoder_lut:
+.ifdef HAVE_ZBB
+    addi t0,a0,16
+    clz t0,t0
+    la t1,uf8_clz_exponent
+    add t1,t1,t0
+    lbu t1,0(t1) #exponent
+.else
+    la t0,uf8_offset_lut
+    mv t1,t0
+    lw t2,32(t1) #offset[e + 8]
+    sltu t2,a0,t2
+    xori t2,t2,1
+    slli t2,t2,5
+    add t1,t1,t2
+    lw t2,16(t1) #offset[e + 4]
+    sltu t2,a0,t2
+    xori t2,t2,1
+    slli t2,t2,4
+    add t1,t1,t2
+    lw t2,8(t1) #offset[e + 2]
+    sltu t2,a0,t2
+    xori t2,t2,1
+    slli t2,t2,3
+    add t1,t1,t2
+    lw t2,4(t1) #offset[e + 1]
+    sltu t2,a0,t2
+    xori t2,t2,1
+    slli t2,t2,2
+    add t1,t1,t2
+    sub t1,t1,t0
+    srli t1,t1,2 #exponent
+.endif
+    addi t0,a0,16
+    srl t0,t0,t1
+    addi t0,t0,-16 #mantissa
+    slli a0,t1,4
+    or a0,a0,t0
+    ret
+
+# r = min(v, 0xF7FF0), the value of code 0xFF, as an unsigned compare
+.macro uf8_clamp r, v, t1, t2
+    li \t1, 0xF7FF0
+    sltu \t2, \t1, \v
+    neg \t2, \t2
+    xor \t1, \v, \t1
+    and \t1, \t1, \t2
+    xor \r, \v, \t1
+.endm
+
+# uf8_encoder with explicit saturation: values above 0xF7FF0 encode as
+# 0xFF instead of running the mantissa past 15
+.type uf8_encoder_sat, @function
+uf8_encoder_sat:
+    uf8_clamp a0, a0, t0, t1
+    uf8_enc t3, a0, t1, t2
+    mv a0, t3
+    ret
+
+# Saturating and round to nearest, halves up. Consecutive codes are
+# 2^e apart even across an exponent change, so rounding up is adding
+# bit e - 1 of value + 16 to the truncated code; at 0xFF that bit is
+# clear for every clamped value, so the code never passes 0xFF.
+.type uf8_encoder_round, @function
+uf8_encoder_round:
+    uf8_clamp a0, a0, t0, t1
+    uf8_enc t3, a0, t1, t2
+    srli t1, t3, 4 #exponent
+    addi t2, a0, 16
+    slli t2, t2, 1
+    srl t2, t2, t1
+    andi t2, t2, 1 #bit e - 1 of value + 16, 0 when e = 0
+    add a0, t3, t2
+    ret
@@ -0,0 +1,150 @@
+#ifndef UF8_STREAM_H
+#define UF8_STREAM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* ============= uf8 Stream Compression ============= */
+
+/* A stream of uf8 codes as one byte per token, each relative to the
+ * previous code (0 before the first):
+ *   0x00-0x7F  the previous code repeated b + 1 times (1..128)
+ *   0x80-0xFE  the previous code plus b - 0xBF (-63..63, never 0)
+ *   0xFF       escape, the next byte is the code itself
+ * Both directions keep only a few bytes of state between chunks. */
+
+#define UF8_STREAM_RUN_MAX 128
+#define UF8_STREAM_DELTA_BIAS 0xBF
+#define UF8_STREAM_DELTA_MAX 63
+#define UF8_STREAM_LITERAL 0xFF
+
+/* Worst case output of uf8_stream_compress for n codes: every code an
+ * escaped literal, plus the run pending from the previous chunk */
+#define UF8_STREAM_BOUND(n) (2 * (n) + 1)
+
+typedef struct {
+    uint8_t prev;
+    uint8_t run; /* repeats of prev not yet written */
+} uf8_stream_enc_t;
+
+typedef struct {
+    uint8_t prev;
+    uint8_t run;  /* repeats of prev not yet emitted */
+    bool literal; /* an escape ended the last chunk */
+} uf8_stream_dec_t;
+
+static inline void uf8_stream_enc_init(uf8_stream_enc_t *s)
+{
+    s->prev = 0;
+    s->run = 0;
+}
+
+static inline void uf8_stream_dec_init(uf8_stream_dec_t *s)
+{
+    s->prev = 0;
+    s->run = 0;
+    s->literal = false;
+}
+
+/* Compress the next n codes into out, which must hold
+ * UF8_STREAM_BOUND(n) bytes; returns the bytes written. A run still
+ * open at the end stays in s for the next chunk or uf8_stream_finish. */
+static size_t uf8_stream_compress(uf8_stream_enc_t *s,
+                                  const uint8_t *in,
+                                  size_t n,
+                                  uint8_t *out)
+{
+    uint8_t *p = out;
+    uint8_t prev = s->prev;
+    unsigned run = s->run;
+
+    for (size_t i = 0; i < n; i++) {
+        uint8_t c = in[i];
+        if (c == prev) {
+            if (++run == UF8_STREAM_RUN_MAX) {
+                *p++ = UF8_STREAM_RUN_MAX - 1;
+                run = 0;
+            }
+            continue;
+        }
+        if (run) {
+            *p++ = run - 1;
+            run = 0;
+        }
+
+        int delta = (int) c - (int) prev;
+        if (delta >= -UF8_STREAM_DELTA_MAX && delta <= UF8_STREAM_DELTA_MAX) {
+            *p++ = UF8_STREAM_DELTA_BIAS + delta;
+        } else {
+            *p++ = UF8_STREAM_LITERAL;
+            *p++ = c;
+        }
+        prev = c;
+    }
+
+    s->prev = prev;
+    s->run = run;
+    return p - out;
+}
+
+/* Write the open run, at most one byte; s can then start a new stream
+ * continuing from the same previous code */
+static size_t uf8_stream_finish(uf8_stream_enc_t *s, uint8_t *out)
+{
+    if (!s->run)
+        return 0;
+    out[0] = s->run - 1;
+    s->run = 0;
+    return 1;
+}
+
+/* Decode from the n bytes at in into at most cap codes at out; returns
+ * the codes written and sets *used to the bytes consumed. Stops early
+ * only when out is full, with any unfinished run kept in s. */
+static size_t uf8_stream_decompress(uf8_stream_dec_t *s,
+                                    const uint8_t *in,
+                                    size_t n,
+                                    size_t *used,
+                                    uint8_t *out,
+                                    size_t cap)
+{
+    size_t i = 0, o = 0;
+    uint8_t prev = s->prev;
+    unsigned run = s->run;
+    bool literal = s->literal;
+
+    while (o < cap) {
+        if (run) {
+            size_t k = cap - o < run ? cap - o : run;
+            run -= k;
+            while (k--)
+                out[o++] = prev;
+            continue;
+        }
+        if (i == n)
+            break;
+
+        uint8_t b = in[i++];
+        if (literal) {
+            literal = false;
+            prev = b;
+            out[o++] = prev;
+        } else if (b < UF8_STREAM_RUN_MAX) {
+            run = b + 1;
+        } else if (b == UF8_STREAM_LITERAL) {
+            literal = true;
+        } else {
+            prev += b - UF8_STREAM_DELTA_BIAS;
+            out[o++] = prev;
+        }
+    }
+
+    s->prev = prev;
+    s->run = run;
+    s->literal = literal;
+    *used = i;
+    return o;
+}
+
+#endif /* UF8_STREAM_H */